@@ -1,11 +1,13 @@
 #include "Input.h"
 #include <GLFW/glfw3.h>
+#include <cstring>
 #include <utility>
 
 namespace Groove {
     static double s_LastX = 0.0, s_LastY = 0.0;
     static bool   s_FirstMouse = true;
     static GLFWwindow* s_Window = nullptr;
+    static const InputState* s_Override = nullptr;
 
     void Input::Init(GLFWwindow* window) {
         s_Window = window;
@@ -13,20 +15,29 @@ namespace Groove {
     }
 
     bool Input::IsKeyPressed(int key) {
+        if (s_Override)
+            return key >= 0 && key <= GLFW_KEY_LAST && ((s_Override->Keys[key >> 3] >> (key & 7)) & 1) != 0;
         return glfwGetKey(s_Window, key) == GLFW_PRESS;
     }
 
     bool Input::IsMouseButtonPressed(int button) {
+        if (s_Override)
+            return button >= 0 && button <= GLFW_MOUSE_BUTTON_LAST && ((s_Override->MouseButtons >> button) & 1) != 0;
         return glfwGetMouseButton(s_Window, button) == GLFW_PRESS;
     }
 
     void Input::GetMousePosition(double& x, double& y) {
+        if (s_Override) {
+            x = s_Override->CursorX;
+            y = s_Override->CursorY;
+            return;
+        }
         glfwGetCursorPos(s_Window, &x, &y);
     }
 
     void Input::GetMouseDelta(double& dx, double& dy) {
         double x, y;
-        glfwGetCursorPos(s_Window, &x, &y);
+        GetMousePosition(x, y);
         if (s_FirstMouse) {
             s_LastX = x; s_LastY = y;
             s_FirstMouse = false;
@@ -35,4 +46,26 @@ namespace Groove {
         dy = s_LastY - y;  // y inverted
         s_LastX = x; s_LastY = y;
     }
+
+    void Input::CaptureState(InputState& out) {
+        std::memset(out.Keys, 0, sizeof(out.Keys));
+        // GLFW rejects codes below GLFW_KEY_SPACE
+        for (int key = GLFW_KEY_SPACE; key <= GLFW_KEY_LAST; key++) {
+            if (glfwGetKey(s_Window, key) == GLFW_PRESS)
+                out.Keys[key >> 3] |= (uint8_t)(1 << (key & 7));
+        }
+        out.MouseButtons = 0;
+        for (int button = 0; button <= GLFW_MOUSE_BUTTON_LAST; button++) {
+            if (glfwGetMouseButton(s_Window, button) == GLFW_PRESS)
+                out.MouseButtons |= (uint8_t)(1 << button);
+        }
+        double x, y;
+        glfwGetCursorPos(s_Window, &x, &y);
+        out.CursorX = (float)x;
+        out.CursorY = (float)y;
+    }
+
+    void Input::SetOverride(const InputState* state) {
+        s_Override = state;
+    }
 }
@@ -1,8 +1,19 @@
 #pragma once
 
 #include <GLFW/glfw3.h>
+#include <cstdint>
 
 namespace Groove {
+
+    // Everything Input reports for one frame, used for recording and replay
+    struct InputState {
+        static const int KeyBytes = (GLFW_KEY_LAST + 1 + 7) / 8;
+
+        uint8_t Keys[KeyBytes];   // one bit per GLFW key code
+        uint8_t MouseButtons;     // one bit per GLFW mouse button
+        float CursorX, CursorY;
+    };
+
     class Input {
     public:
         static void Init(GLFWwindow* window);
@@ -12,5 +23,10 @@ namespace Groove {
 
         static void  GetMousePosition(double& x, double& y);
         static void  GetMouseDelta(double& dx, double& dy);  // NEW
+
+        // Snapshot the live GLFW state
+        static void CaptureState(InputState& out);
+        // Answer every query from state instead of GLFW (nullptr = live input again)
+        static void SetOverride(const InputState* state);
     };
 }
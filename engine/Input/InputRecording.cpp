@@ -0,0 +1,166 @@
+#include "InputRecording.h"
+#include "../Utils/Logger.h"
+
+#include <cstring>
+
+namespace Groove {
+
+    static const char Magic[4] = { 'G', 'R', 'I', 'N' };
+    static const uint16_t Version = 1;
+    static const size_t HeaderSize = 16;
+    static const size_t FrameCountOffset = 12;
+
+    enum FrameFlags : uint8_t {
+        ChangedKeys = 1 << 0,
+        ChangedButtons = 1 << 1,
+        ChangedCursor = 1 << 2,
+        ChangedSize = 1 << 3
+    };
+
+    InputRecorder::~InputRecorder() {
+        Close();
+    }
+
+    bool InputRecorder::Open(const char* path, uint16_t width, uint16_t height) {
+        Close();
+        m_File = std::fopen(path, "wb");
+        if (!m_File) {
+            Logger::Error("InputRecorder: could not open recording file");
+            return false;
+        }
+
+        uint8_t header[HeaderSize] = {};
+        uint16_t keyBytes = InputState::KeyBytes;
+        std::memcpy(header, Magic, 4);
+        std::memcpy(header + 4, &Version, 2);
+        std::memcpy(header + 6, &keyBytes, 2);
+        std::memcpy(header + 8, &width, 2);
+        std::memcpy(header + 10, &height, 2);
+        std::fwrite(header, 1, HeaderSize, m_File);
+        m_FrameCount = 0;
+        return true;
+    }
+
+    void InputRecorder::WriteFrame(const InputFrame& frame) {
+        if (!m_File)
+            return;
+
+        // First frame writes every field, later frames only what changed
+        bool first = m_FrameCount == 0;
+        uint8_t flags = 0;
+        if (first || std::memcmp(frame.State.Keys, m_Previous.State.Keys, InputState::KeyBytes) != 0)
+            flags |= ChangedKeys;
+        if (first || frame.State.MouseButtons != m_Previous.State.MouseButtons)
+            flags |= ChangedButtons;
+        if (first || frame.State.CursorX != m_Previous.State.CursorX || frame.State.CursorY != m_Previous.State.CursorY)
+            flags |= ChangedCursor;
+        if (first || frame.Width != m_Previous.Width || frame.Height != m_Previous.Height)
+            flags |= ChangedSize;
+
+        uint8_t buffer[1 + 4 + InputState::KeyBytes + 1 + 8 + 4];
+        size_t size = 0;
+        buffer[size++] = flags;
+        std::memcpy(buffer + size, &frame.DeltaTime, 4); size += 4;
+        if (flags & ChangedKeys) {
+            std::memcpy(buffer + size, frame.State.Keys, InputState::KeyBytes);
+            size += InputState::KeyBytes;
+        }
+        if (flags & ChangedButtons)
+            buffer[size++] = frame.State.MouseButtons;
+        if (flags & ChangedCursor) {
+            std::memcpy(buffer + size, &frame.State.CursorX, 4); size += 4;
+            std::memcpy(buffer + size, &frame.State.CursorY, 4); size += 4;
+        }
+        if (flags & ChangedSize) {
+            std::memcpy(buffer + size, &frame.Width, 2); size += 2;
+            std::memcpy(buffer + size, &frame.Height, 2); size += 2;
+        }
+        std::fwrite(buffer, 1, size, m_File);
+
+        m_Previous = frame;
+        m_FrameCount++;
+    }
+
+    void InputRecorder::Close() {
+        if (!m_File)
+            return;
+        std::fseek(m_File, (long)FrameCountOffset, SEEK_SET);
+        std::fwrite(&m_FrameCount, 4, 1, m_File);
+        std::fclose(m_File);
+        m_File = nullptr;
+    }
+
+    bool InputPlayer::Open(const char* path) {
+        std::FILE* file = std::fopen(path, "rb");
+        if (!file) {
+            Logger::Error("InputPlayer: could not open recording file");
+            return false;
+        }
+        std::fseek(file, 0, SEEK_END);
+        long length = std::ftell(file);
+        std::fseek(file, 0, SEEK_SET);
+        m_Data.resize(length > 0 ? (size_t)length : 0);
+        size_t read = std::fread(m_Data.data(), 1, m_Data.size(), file);
+        std::fclose(file);
+
+        uint16_t version = 0, keyBytes = 0;
+        if (read < HeaderSize || std::memcmp(m_Data.data(), Magic, 4) != 0) {
+            Logger::Error("InputPlayer: not an input recording");
+            m_Data.clear();
+            return false;
+        }
+        std::memcpy(&version, &m_Data[4], 2);
+        std::memcpy(&keyBytes, &m_Data[6], 2);
+        if (version != Version || keyBytes != InputState::KeyBytes) {
+            Logger::Error("InputPlayer: unsupported recording version");
+            m_Data.clear();
+            return false;
+        }
+        std::memcpy(&m_Width, &m_Data[8], 2);
+        std::memcpy(&m_Height, &m_Data[10], 2);
+        std::memcpy(&m_FrameCount, &m_Data[FrameCountOffset], 4);
+
+        m_Cursor = HeaderSize;
+        m_FrameIndex = 0;
+        std::memset(&m_Current, 0, sizeof(m_Current));
+        m_Current.Width = m_Width;
+        m_Current.Height = m_Height;
+        return true;
+    }
+
+    bool InputPlayer::ReadFrame(InputFrame& frame) {
+        // A count of 0 means the recorder never closed (crash); play whatever was written
+        if ((m_FrameCount && m_FrameIndex >= m_FrameCount) || m_Cursor + 5 > m_Data.size())
+            return false;
+
+        const uint8_t* data = m_Data.data();
+        uint8_t flags = data[m_Cursor++];
+        size_t needed = 4 + ((flags & ChangedKeys) ? InputState::KeyBytes : 0) + ((flags & ChangedButtons) ? 1 : 0) +
+                        ((flags & ChangedCursor) ? 8 : 0) + ((flags & ChangedSize) ? 4 : 0);
+        if (m_Cursor + needed > m_Data.size()) {
+            Logger::Error("InputPlayer: recording is truncated");
+            return false;
+        }
+
+        std::memcpy(&m_Current.DeltaTime, data + m_Cursor, 4); m_Cursor += 4;
+        if (flags & ChangedKeys) {
+            std::memcpy(m_Current.State.Keys, data + m_Cursor, InputState::KeyBytes);
+            m_Cursor += InputState::KeyBytes;
+        }
+        if (flags & ChangedButtons)
+            m_Current.State.MouseButtons = data[m_Cursor++];
+        if (flags & ChangedCursor) {
+            std::memcpy(&m_Current.State.CursorX, data + m_Cursor, 4); m_Cursor += 4;
+            std::memcpy(&m_Current.State.CursorY, data + m_Cursor, 4); m_Cursor += 4;
+        }
+        if (flags & ChangedSize) {
+            std::memcpy(&m_Current.Width, data + m_Cursor, 2); m_Cursor += 2;
+            std::memcpy(&m_Current.Height, data + m_Cursor, 2); m_Cursor += 2;
+        }
+
+        frame = m_Current;
+        m_FrameIndex++;
+        return true;
+    }
+
+}
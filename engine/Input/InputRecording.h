@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Input.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace Groove {
+
+    // One recorded frame: input plus the timing and window size the frame ran with
+    struct InputFrame {
+        InputState State;
+        float DeltaTime;
+        uint16_t Width, Height;
+    };
+
+    // Recording file (.grin, native byte order):
+    //   header: "GRIN", u16 version, u16 key bytes, u16 width, u16 height, u32 frame count
+    //   frames: u8 changed-field flags, f32 delta time, then only the fields that changed
+    //           (key bitset, mouse buttons, cursor x/y as f32, width/height as u16)
+    class InputRecorder {
+    public:
+        ~InputRecorder();
+
+        bool Open(const char* path, uint16_t width, uint16_t height);
+        void WriteFrame(const InputFrame& frame);
+        // Patches the frame count into the header
+        void Close();
+
+        uint32_t GetFrameCount() const { return m_FrameCount; }
+
+    private:
+        std::FILE* m_File = nullptr;
+        InputFrame m_Previous;
+        uint32_t m_FrameCount = 0;
+    };
+
+    // Loads a whole recording up front so replay never touches the disk mid-run
+    class InputPlayer {
+    public:
+        bool Open(const char* path);
+        // Decodes the next frame; false once the recording is exhausted
+        bool ReadFrame(InputFrame& frame);
+
+        uint32_t GetFrameCount() const { return m_FrameCount; }
+        uint32_t GetFrameIndex() const { return m_FrameIndex; }
+        uint16_t GetWidth() const { return m_Width; }
+        uint16_t GetHeight() const { return m_Height; }
+
+    private:
+        std::vector<uint8_t> m_Data;
+        size_t m_Cursor = 0;
+        InputFrame m_Current;
+        uint32_t m_FrameCount = 0, m_FrameIndex = 0;
+        uint16_t m_Width = 0, m_Height = 0;
+    };
+
+}
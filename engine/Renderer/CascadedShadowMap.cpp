@@ -0,0 +1,319 @@
+#include "CascadedShadowMap.h"
+#include "Shader.h"
+#include "StaticBatch.h"
+#include "../src/Transform.hpp"
+#include "../src/Frustum.hpp"
+#include "../Utils/BatchMath.h"
+#include "../Utils/JobSystem.h"
+#include "../Utils/Logger.h"
+#include "../Utils/MemoryTracker.h"
+#include <Camera.h>
+
+#include <glad/glad.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+namespace Groove {
+
+    const uint32_t CascadedShadowMap::CascadeCount;
+    const uint32_t CascadedShadowMap::FirstCachedCascade;
+    const uint32_t CascadedShadowMap::RingSize;
+    const int CascadedShadowMap::TextureUnit;
+
+    // Blend between logarithmic (1) and uniform (0) split distances
+    static const float SplitLambda = 0.75f;
+    // Cached cascades cover this much more than their slice so the camera can move inside them
+    static const float CacheMargin = 1.25f;
+    // Slice radius change (relative) a cached cascade tolerates before it is refitted; the margin
+    // containment test below still guarantees the slice is covered
+    static const float CacheRadiusTolerance = 0.01f;
+    // Depth range extended toward the light so casters outside the slice still land in the map
+    static const float CasterReach = 50.0f;
+
+    CascadedShadowMap::CascadedShadowMap(uint32_t resolution)
+        : m_Resolution(resolution) {
+        glGenTextures(1, &m_DepthArray);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, m_DepthArray);
+        glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_DEPTH_COMPONENT32F, (GLsizei)m_Resolution, (GLsizei)m_Resolution,
+                     CascadeCount, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+        // Hardware 2x2 comparison filtering; outside the map counts as lit
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
+        const float border[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+        glTexParameterfv(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_BORDER_COLOR, border);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+        glGenFramebuffers(1, &m_FBO);
+        glBindFramebuffer(GL_FRAMEBUFFER, m_FBO);
+        glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, m_DepthArray, 0, 0);
+        glDrawBuffer(GL_NONE);
+        glReadBuffer(GL_NONE);
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+            Logger::Error("CascadedShadowMap: framebuffer incomplete");
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+        for (Slot& slot : m_Slots)
+            glGenQueries(2, slot.Queries);
+
+        m_GpuBytes = (int64_t)m_Resolution * m_Resolution * CascadeCount * sizeof(float);
+        MemoryTracker::TrackGpuAlloc(MemTag::Renderer, m_GpuBytes);
+    }
+
+    CascadedShadowMap::~CascadedShadowMap() {
+        glDeleteFramebuffers(1, &m_FBO);
+        glDeleteTextures(1, &m_DepthArray);
+        for (Slot& slot : m_Slots)
+            glDeleteQueries(2, slot.Queries);
+        MemoryTracker::TrackGpuFree(MemTag::Renderer, m_GpuBytes);
+    }
+
+    void CascadedShadowMap::FitCascade(Cascade& cascade, const glm::vec3& center, float radius) {
+        // Light space shares one rotation for every cascade and frame; only the ortho window
+        // moves, and only in whole texels, so static edges rasterize identically frame to frame
+        float texel = 2.0f * radius / (float)m_Resolution;
+        glm::vec3 lightCenter = m_LightRotation * center;
+        lightCenter.x = std::floor(lightCenter.x / texel) * texel;
+        lightCenter.y = std::floor(lightCenter.y / texel) * texel;
+
+        // The light looks down -z: casters between the slice and the light have larger z
+        glm::mat4 proj = glm::ortho(lightCenter.x - radius, lightCenter.x + radius,
+                                    lightCenter.y - radius, lightCenter.y + radius,
+                                    -(lightCenter.z + radius + CasterReach), -(lightCenter.z - radius));
+        cascade.ViewProj = proj * glm::mat4(m_LightRotation);
+        cascade.Center = glm::transpose(m_LightRotation) * lightCenter;
+        cascade.Radius = radius;
+        cascade.TexelWorld = texel;
+        cascade.Valid = true;
+    }
+
+    void CascadedShadowMap::Prepare(const Camera& cam, const DirectionalLight& light, const Transform* dynamicObjects,
+                                    uint32_t dynamicCount, const StaticBatch* staticBatch) {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        glm::vec3 direction = glm::normalize(light.Direction);
+        bool lightChanged = glm::length(direction - m_LightDirection) > 1e-6f;
+        if (lightChanged) {
+            m_LightDirection = direction;
+            glm::vec3 up = std::abs(direction.y) > 0.99f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+            m_LightRotation = glm::mat3(glm::lookAt(glm::vec3(0.0f), direction, up));
+        }
+
+        uint32_t staticVersion = staticBatch ? staticBatch->GetVersion() : 0;
+        bool staticChanged = staticBatch != m_StaticBatch || staticVersion != m_StaticVersion;
+        m_StaticBatch = staticBatch;
+        m_StaticVersion = staticVersion;
+        uint32_t staticCount = staticBatch && staticBatch->IsBuilt() ? staticBatch->GetObjectCount() : 0;
+
+        // Camera frustum corners on the near and far planes; slices interpolate along the corner rays
+        glm::mat4 invViewProj = glm::inverse(cam.GetProjectionMatrix() * cam.GetViewMatrix());
+        glm::vec3 nearCorners[4], farCorners[4];
+        for (int i = 0; i < 4; i++) {
+            float x = (i & 1) ? 1.0f : -1.0f;
+            float y = (i & 2) ? 1.0f : -1.0f;
+            glm::vec4 n = invViewProj * glm::vec4(x, y, -1.0f, 1.0f);
+            glm::vec4 f = invViewProj * glm::vec4(x, y, 1.0f, 1.0f);
+            nearCorners[i] = glm::vec3(n) / n.w;
+            farCorners[i] = glm::vec3(f) / f.w;
+        }
+        float nearClip = cam.GetNearClip();
+        float farClip = cam.GetFarClip();
+        float shadowFar = std::min(farClip, m_ShadowDistance);
+
+        float splitNear = nearClip;
+        for (uint32_t c = 0; c < CascadeCount; c++) {
+            float t = (float)(c + 1) / (float)CascadeCount;
+            float logSplit = nearClip * std::pow(shadowFar / nearClip, t);
+            float uniformSplit = nearClip + (shadowFar - nearClip) * t;
+            float splitFar = SplitLambda * logSplit + (1.0f - SplitLambda) * uniformSplit;
+
+            glm::vec3 corners[8];
+            glm::vec3 center(0.0f);
+            for (int i = 0; i < 4; i++) {
+                glm::vec3 ray = farCorners[i] - nearCorners[i];
+                corners[i] = nearCorners[i] + ray * ((splitNear - nearClip) / (farClip - nearClip));
+                corners[i + 4] = nearCorners[i] + ray * ((splitFar - nearClip) / (farClip - nearClip));
+                center += corners[i] + corners[i + 4];
+            }
+            center /= 8.0f;
+            float radius = 0.0f;
+            for (const glm::vec3& corner : corners)
+                radius = std::max(radius, glm::length(corner - center));
+            // A sphere keeps the size fixed under rotation; rounding keeps float noise out of it
+            radius = std::ceil(radius * 16.0f) / 16.0f;
+
+            Cascade& cascade = m_Cascades[c];
+            cascade.SplitFar = splitFar;
+            if (c < FirstCachedCascade || !m_Caching) {
+                FitCascade(cascade, center, radius);
+                cascade.NeedsRender = true;
+            }
+            else {
+                bool inside = cascade.Valid && !lightChanged &&
+                              std::abs(cascade.SliceRadius - radius) <= CacheRadiusTolerance * radius &&
+                              glm::length(center - cascade.Center) + radius <= cascade.Radius;
+                if (!inside) {
+                    FitCascade(cascade, center, radius * CacheMargin);
+                    cascade.SliceRadius = radius;
+                }
+                cascade.NeedsRender = !inside || staticChanged;
+            }
+            splitNear = splitFar;
+        }
+
+        // One parallel pass over every caster fills the masks of all cascades that will render
+        Frustum frustums[CascadeCount];
+        bool anyRender = false;
+        for (uint32_t c = 0; c < CascadeCount; c++) {
+            if (!m_Cascades[c].NeedsRender)
+                continue;
+            anyRender = true;
+            frustums[c] = Frustum::FromNDCRect(m_Cascades[c].ViewProj, -1.0f, -1.0f, 1.0f, 1.0f);
+            if (DrawsDynamic(c))
+                m_DynamicMask[c].resize(dynamicCount);
+            m_StaticMask[c].resize(staticCount);
+        }
+
+        std::atomic<uint32_t> dynamicCasters(0), staticCasters(0), culledCasters(0);
+        if (anyRender) {
+            m_DynamicMatrices.resize(dynamicCount);
+            m_DynamicMin.resize(dynamicCount);
+            m_DynamicMax.resize(dynamicCount);
+            const glm::vec3* staticMin = staticCount ? staticBatch->GetObjectMin() : nullptr;
+            const glm::vec3* staticMax = staticCount ? staticBatch->GetObjectMax() : nullptr;
+            JobSystem::ParallelFor(dynamicCount + staticCount, 1024, [&](uint32_t begin, uint32_t end) {
+                uint32_t localDynamic = 0, localStatic = 0, localTested = 0;
+                // This job's share of the dynamic objects: matrices and bounds in SIMD blocks
+                if (begin < dynamicCount) {
+                    uint32_t dynamicEnd = std::min(end, dynamicCount);
+                    BatchMath::ComposeTransforms(dynamicObjects + begin, dynamicEnd - begin, &m_DynamicMatrices[begin],
+                                                 &m_DynamicMin[begin], &m_DynamicMax[begin]);
+                }
+                for (uint32_t i = begin; i < end; i++) {
+                    if (i < dynamicCount) {
+                        const glm::vec3& min = m_DynamicMin[i];
+                        const glm::vec3& max = m_DynamicMax[i];
+                        for (uint32_t c = 0; c < FirstCachedCascade; c++) {
+                            if (!m_Cascades[c].NeedsRender)
+                                continue;
+                            uint8_t visible = frustums[c].IntersectsAABB(min, max) ? 1 : 0;
+                            m_DynamicMask[c][i] = visible;
+                            localDynamic += visible;
+                            localTested++;
+                        }
+                    }
+                    else {
+                        uint32_t s = i - dynamicCount;
+                        for (uint32_t c = 0; c < CascadeCount; c++) {
+                            if (!m_Cascades[c].NeedsRender)
+                                continue;
+                            uint8_t visible = frustums[c].IntersectsAABB(staticMin[s], staticMax[s]) ? 1 : 0;
+                            m_StaticMask[c][s] = visible;
+                            localStatic += visible;
+                            localTested++;
+                        }
+                    }
+                }
+                dynamicCasters += localDynamic;
+                staticCasters += localStatic;
+                culledCasters += localTested - localDynamic - localStatic;
+            });
+        }
+
+        m_Stats.DynamicCasters = dynamicCasters.load();
+        m_Stats.StaticCasters = staticCasters.load();
+        m_Stats.CulledCasters = culledCasters.load();
+        m_Stats.CullMs = std::chrono::duration<float, std::milli>(
+            std::chrono::high_resolution_clock::now() - start).count();
+    }
+
+    void CascadedShadowMap::BeginRender() {
+        m_SubmitStart = std::chrono::high_resolution_clock::now();
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &m_SavedFramebuffer);
+        glGetIntegerv(GL_VIEWPORT, m_SavedViewport);
+
+        m_Stats.CascadesRendered = 0;
+        for (const Cascade& cascade : m_Cascades)
+            m_Stats.CascadesRendered += cascade.NeedsRender ? 1 : 0;
+
+        // Skip timing rather than wait if every slot is still in flight
+        m_Timing = m_Stats.CascadesRendered > 0 && !m_Slots[m_Head].Pending;
+        if (m_Timing)
+            glQueryCounter(m_Slots[m_Head].Queries[0], GL_TIMESTAMP);
+
+        glBindFramebuffer(GL_FRAMEBUFFER, m_FBO);
+        glViewport(0, 0, (GLsizei)m_Resolution, (GLsizei)m_Resolution);
+        // Slope-scaled offset against acne; the forward shader adds a normal offset on top
+        glEnable(GL_POLYGON_OFFSET_FILL);
+        glPolygonOffset(1.5f, 2.0f);
+    }
+
+    void CascadedShadowMap::BeginCascade(uint32_t cascade) {
+        glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, m_DepthArray, 0, (GLint)cascade);
+        glClear(GL_DEPTH_BUFFER_BIT);
+    }
+
+    void CascadedShadowMap::EndRender(uint32_t drawCalls) {
+        glDisable(GL_POLYGON_OFFSET_FILL);
+        glBindFramebuffer(GL_FRAMEBUFFER, (GLuint)m_SavedFramebuffer);
+        glViewport(m_SavedViewport[0], m_SavedViewport[1], m_SavedViewport[2], m_SavedViewport[3]);
+
+        if (m_Timing) {
+            Slot& slot = m_Slots[m_Head];
+            glQueryCounter(slot.Queries[1], GL_TIMESTAMP);
+            slot.Pending = true;
+            m_Head = (m_Head + 1) % RingSize;
+        }
+        else if (m_Stats.CascadesRendered == 0) {
+            m_Stats.GpuMs = 0.0f;
+        }
+
+        m_Stats.DrawCalls = drawCalls;
+        m_Stats.SubmitMs = std::chrono::duration<float, std::milli>(
+            std::chrono::high_resolution_clock::now() - m_SubmitStart).count();
+        PollTimings();
+    }
+
+    void CascadedShadowMap::PollTimings() {
+        // Oldest in-flight slot first; stop at the first one the GPU has not finished
+        for (uint32_t i = 0; i < RingSize; i++) {
+            Slot& slot = m_Slots[(m_Head + i) % RingSize];
+            if (!slot.Pending)
+                continue;
+            GLint available = 0;
+            glGetQueryObjectiv(slot.Queries[1], GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available)
+                break;
+
+            GLuint64 begin = 0, end = 0;
+            glGetQueryObjectui64v(slot.Queries[0], GL_QUERY_RESULT, &begin);
+            glGetQueryObjectui64v(slot.Queries[1], GL_QUERY_RESULT, &end);
+            slot.Pending = false;
+            m_Stats.GpuMs = (float)((double)(end - begin) / 1.0e6);
+        }
+    }
+
+    void CascadedShadowMap::Bind(Shader& shader) const {
+        static const char* const viewProjNames[CascadeCount] = {
+            "u_CascadeViewProj[0]", "u_CascadeViewProj[1]", "u_CascadeViewProj[2]", "u_CascadeViewProj[3]"
+        };
+
+        glActiveTexture(GL_TEXTURE0 + TextureUnit);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, m_DepthArray);
+        glActiveTexture(GL_TEXTURE0);
+
+        shader.SetUniform1i("u_ShadowMap", TextureUnit);
+        for (uint32_t c = 0; c < CascadeCount; c++)
+            shader.SetUniformMat4f(viewProjNames[c], m_Cascades[c].ViewProj);
+        shader.SetUniform4f("u_CascadeSplits", glm::vec4(m_Cascades[0].SplitFar, m_Cascades[1].SplitFar,
+                                                         m_Cascades[2].SplitFar, m_Cascades[3].SplitFar));
+        shader.SetUniform4f("u_CascadeTexel", glm::vec4(m_Cascades[0].TexelWorld, m_Cascades[1].TexelWorld,
+                                                        m_Cascades[2].TexelWorld, m_Cascades[3].TexelWorld));
+    }
+
+}
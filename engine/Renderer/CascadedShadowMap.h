@@ -0,0 +1,128 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace Groove {
+
+    class Camera;
+    class Shader;
+    class StaticBatch;
+    struct Transform;
+
+    struct DirectionalLight {
+        glm::vec3 Direction{ -0.4f, -1.0f, -0.3f };  // direction the light travels (normalized on use)
+        glm::vec3 Color{ 1.0f, 0.95f, 0.85f };
+        float     Intensity = 0.6f;
+    };
+
+    struct ShadowStats {
+        uint32_t CascadesRendered = 0;   // of CascadeCount, this frame
+        uint32_t DrawCalls = 0;
+        uint32_t DynamicCasters = 0;     // per-cascade caster submissions, summed
+        uint32_t StaticCasters = 0;
+        uint32_t CulledCasters = 0;      // caster/cascade tests rejected by the cascade frustum
+        float    CullMs = 0.0f;          // fitting + parallel draw-list build
+        float    SubmitMs = 0.0f;        // CPU cost of the depth passes
+        float    GpuMs = 0.0f;           // depth passes on the GPU, a frame or two old
+    };
+
+    // Shadow cascades for one directional light, rendered into a depth texture array.
+    // Each cascade is fitted to a bounding sphere of its slice of the camera frustum and snapped
+    // to whole shadow texels, so the map does not shimmer as the camera moves or turns.
+    // Cascades from FirstCachedCascade on hold static geometry only; they are fitted with a margin
+    // and re-rendered only when the camera leaves that margin, the light moves or the static
+    // batch is rebuilt.
+    class CascadedShadowMap {
+    public:
+        static const uint32_t CascadeCount = 4;
+        static const uint32_t FirstCachedCascade = 2;
+        static const uint32_t RingSize = 3;
+        static const int      TextureUnit = 1;     // sampler unit used by the forward shader
+
+        explicit CascadedShadowMap(uint32_t resolution = 2048);
+        ~CascadedShadowMap();
+
+        CascadedShadowMap(const CascadedShadowMap&) = delete;
+        CascadedShadowMap& operator=(const CascadedShadowMap&) = delete;
+
+        // Fits the cascades, decides which need rendering and fills their caster masks on the
+        // JobSystem. staticBatch may be null (no static casters).
+        void Prepare(const Camera& cam, const DirectionalLight& light, const Transform* dynamicObjects,
+                     uint32_t dynamicCount, const StaticBatch* staticBatch);
+
+        // Depth-pass helpers for the renderer: Begin saves the framebuffer and viewport,
+        // BeginCascade binds and clears one layer, End restores them and records timings
+        void BeginRender();
+        void BeginCascade(uint32_t cascade);
+        void EndRender(uint32_t drawCalls);
+
+        // Cascade matrices, splits and the depth array for the forward shader
+        void Bind(Shader& shader) const;
+
+        bool NeedsRender(uint32_t cascade) const { return m_Cascades[cascade].NeedsRender; }
+        const glm::mat4& GetViewProj(uint32_t cascade) const { return m_Cascades[cascade].ViewProj; }
+        // Per-object caster masks in the order passed to Prepare (dynamic) / StaticBatch::Add (static)
+        const uint8_t* GetDynamicMask(uint32_t cascade) const { return m_DynamicMask[cascade].data(); }
+        const uint8_t* GetStaticMask(uint32_t cascade) const { return m_StaticMask[cascade].data(); }
+        bool DrawsDynamic(uint32_t cascade) const { return cascade < FirstCachedCascade; }
+        // Model matrices of the dynamic casters, composed by Prepare alongside their bounds
+        const glm::mat4* GetDynamicMatrices() const { return m_DynamicMatrices.data(); }
+
+        // With caching off every cascade is re-rendered every frame (for comparison)
+        void SetCaching(bool enabled) { m_Caching = enabled; }
+        bool GetCaching() const { return m_Caching; }
+        void SetShadowDistance(float distance) { m_ShadowDistance = distance; }
+
+        const ShadowStats& GetStats() const { return m_Stats; }
+
+    private:
+        struct Cascade {
+            glm::mat4 ViewProj{ 1.0f };
+            glm::vec3 Center{ 0.0f };    // snapped sphere centre the matrix was built from
+            float     Radius = 0.0f;
+            float     SliceRadius = 0.0f;  // unmargined slice radius a cached cascade was fitted for
+            float     SplitFar = 0.0f;   // view depth where this cascade ends
+            float     TexelWorld = 0.0f; // world size of one shadow texel
+            bool      Valid = false;
+            bool      NeedsRender = false;
+        };
+
+        void FitCascade(Cascade& cascade, const glm::vec3& center, float radius);
+        void PollTimings();
+
+        uint32_t m_Resolution;
+        uint32_t m_DepthArray = 0, m_FBO = 0;
+        int64_t  m_GpuBytes = 0;
+
+        Cascade m_Cascades[CascadeCount];
+        std::vector<uint8_t> m_DynamicMask[CascadeCount];
+        std::vector<uint8_t> m_StaticMask[CascadeCount];
+        std::vector<glm::mat4> m_DynamicMatrices;
+        std::vector<glm::vec3> m_DynamicMin, m_DynamicMax;
+
+        glm::mat3 m_LightRotation{ 1.0f };
+        glm::vec3 m_LightDirection{ 0.0f };
+        const StaticBatch* m_StaticBatch = nullptr;
+        uint32_t m_StaticVersion = 0;
+        float m_ShadowDistance = 80.0f;
+        bool m_Caching = true;
+
+        int m_SavedFramebuffer = 0;
+        int m_SavedViewport[4] = {};
+        std::chrono::high_resolution_clock::time_point m_SubmitStart;
+
+        struct Slot {
+            uint32_t Queries[2] = {};
+            bool     Pending = false;
+        };
+        Slot m_Slots[RingSize];
+        uint32_t m_Head = 0;
+        bool m_Timing = false;
+
+        ShadowStats m_Stats;
+    };
+
+}
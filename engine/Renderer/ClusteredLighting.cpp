@@ -0,0 +1,232 @@
+#include "ClusteredLighting.h"
+#include "../Utils/JobSystem.h"
+#include "../Utils/MemoryTracker.h"
+#include <Camera.h>
+
+#include <glad/glad.h>
+#include <algorithm>
+#include <chrono>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+namespace Groove {
+
+    const uint32_t ClusteredLighting::RingSize;
+
+    ClusteredLighting::ClusteredLighting() {
+        glGenBuffers(1, &m_LightSSBO);
+        glGenBuffers(1, &m_ClusterSSBO);
+        glGenBuffers(1, &m_IndexSSBO);
+        for (Slot& slot : m_Slots)
+            glGenQueries(2, slot.Queries);
+
+        m_ClusterMin.resize(ClusterCount);
+        m_ClusterMax.resize(ClusterCount);
+        m_SliceLights.resize(ClusterZ);
+        m_ClusterCounts.resize(ClusterCount);
+        m_ClusterRanges.resize(ClusterCount * 2);
+    }
+
+    ClusteredLighting::~ClusteredLighting() {
+        glDeleteBuffers(1, &m_LightSSBO);
+        glDeleteBuffers(1, &m_ClusterSSBO);
+        glDeleteBuffers(1, &m_IndexSSBO);
+        for (Slot& slot : m_Slots)
+            glDeleteQueries(2, slot.Queries);
+        MemoryTracker::TrackGpuFree(MemTag::Renderer, (int64_t)(m_LightCapacity + m_ClusterCapacity + m_IndexCapacity));
+    }
+
+    void ClusteredLighting::SetLights(const PointLight* lights, uint32_t count) {
+        m_Lights.assign(lights, lights + count);
+    }
+
+    // Depth of slice boundary s (0..ClusterZ), exponential so near clusters stay small
+    static float SliceDepth(uint32_t s, float zNear, float zFar) {
+        return zNear * std::pow(zFar / zNear, (float)s / (float)ClusteredLighting::ClusterZ);
+    }
+
+    void ClusteredLighting::RebuildClusterBounds(const glm::mat4& proj, float zNear, float zFar) {
+        glm::mat4 invProj = glm::inverse(proj);
+
+        // View-space point on the near plane for an NDC xy, as a ray we can scale to any depth
+        auto nearPoint = [&](float ndcX, float ndcY) {
+            glm::vec4 p = invProj * glm::vec4(ndcX, ndcY, -1.0f, 1.0f);
+            return glm::vec3(p) / p.w;
+        };
+
+        for (uint32_t z = 0; z < ClusterZ; z++) {
+            float d0 = SliceDepth(z, zNear, zFar);
+            float d1 = SliceDepth(z + 1, zNear, zFar);
+            for (uint32_t y = 0; y < ClusterY; y++) {
+                for (uint32_t x = 0; x < ClusterX; x++) {
+                    float x0 = -1.0f + 2.0f * x / ClusterX, x1 = -1.0f + 2.0f * (x + 1) / ClusterX;
+                    float y0 = -1.0f + 2.0f * y / ClusterY, y1 = -1.0f + 2.0f * (y + 1) / ClusterY;
+                    glm::vec3 corners[4] = { nearPoint(x0, y0), nearPoint(x1, y0), nearPoint(x0, y1), nearPoint(x1, y1) };
+
+                    glm::vec3 mn(FLT_MAX), mx(-FLT_MAX);
+                    for (const glm::vec3& c : corners) {
+                        // Scale the near-plane point out to both slice depths (view looks down -Z)
+                        glm::vec3 a = c * (d0 / -c.z);
+                        glm::vec3 b = c * (d1 / -c.z);
+                        mn = glm::min(mn, glm::min(a, b));
+                        mx = glm::max(mx, glm::max(a, b));
+                    }
+                    uint32_t index = x + y * ClusterX + z * ClusterX * ClusterY;
+                    m_ClusterMin[index] = mn;
+                    m_ClusterMax[index] = mx;
+                }
+            }
+        }
+    }
+
+    static bool SphereIntersectsAABB(const glm::vec4& sphere, const glm::vec3& mn, const glm::vec3& mx) {
+        glm::vec3 c(sphere);
+        glm::vec3 closest = glm::clamp(c, mn, mx);
+        glm::vec3 d = closest - c;
+        return glm::dot(d, d) <= sphere.w * sphere.w;
+    }
+
+    void ClusteredLighting::Update(const Camera& cam) {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        const float zNear = cam.GetNearClip();
+        const float zFar = cam.GetFarClip();
+        glm::mat4 proj = cam.GetProjectionMatrix();
+        if (std::memcmp(&proj, &m_CachedProj, sizeof(glm::mat4)) != 0) {
+            RebuildClusterBounds(proj, zNear, zFar);
+            m_CachedProj = proj;
+        }
+
+        // Lights to view space, bucketed by the depth slices they overlap
+        glm::mat4 view = cam.GetViewMatrix();
+        const float logRatio = std::log(zFar / zNear);
+        const uint32_t lightCount = (uint32_t)m_Lights.size();
+        m_ViewLights.resize(lightCount);
+        for (auto& slice : m_SliceLights)
+            slice.clear();
+
+        for (uint32_t i = 0; i < lightCount; i++) {
+            const glm::vec4& pr = m_Lights[i].PositionRadius;
+            glm::vec3 vp = glm::vec3(view * glm::vec4(pr.x, pr.y, pr.z, 1.0f));
+            m_ViewLights[i] = glm::vec4(vp, pr.w);
+
+            float dMin = -vp.z - pr.w, dMax = -vp.z + pr.w;
+            if (dMax < zNear || dMin > zFar)
+                continue;
+            dMin = std::max(dMin, zNear);
+            dMax = std::min(dMax, zFar);
+            uint32_t s0 = (uint32_t)std::max(0.0f, std::floor(std::log(dMin / zNear) / logRatio * ClusterZ));
+            uint32_t s1 = (uint32_t)std::max(0.0f, std::floor(std::log(dMax / zNear) / logRatio * ClusterZ));
+            s1 = std::min(s1, ClusterZ - 1);
+            for (uint32_t s = std::min(s0, s1); s <= s1; s++)
+                m_SliceLights[s].push_back(i);
+        }
+
+        // Two passes over the clusters, both parallel: count each cluster's lights, then fill the
+        // index list at the offsets a prefix sum gives. No per-cluster cap, so the clustered result
+        // always matches the naive loop however many lights overlap.
+        const glm::vec4* viewLights = m_ViewLights.data();
+        JobSystem::ParallelFor(ClusterCount, ClusterX * ClusterY, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t c = begin; c < end; c++) {
+                uint32_t count = 0;
+                for (uint32_t light : m_SliceLights[c / (ClusterX * ClusterY)])
+                    count += SphereIntersectsAABB(viewLights[light], m_ClusterMin[c], m_ClusterMax[c]) ? 1 : 0;
+                m_ClusterCounts[c] = count;
+            }
+        });
+
+        // Compact into (offset, count) ranges + one tight index list
+        uint32_t total = 0, maxInCluster = 0;
+        for (uint32_t c = 0; c < ClusterCount; c++) {
+            m_ClusterRanges[c * 2] = total;
+            m_ClusterRanges[c * 2 + 1] = m_ClusterCounts[c];
+            total += m_ClusterCounts[c];
+            maxInCluster = std::max(maxInCluster, m_ClusterCounts[c]);
+        }
+        m_LightIndices.resize(std::max(total, 1u));
+
+        JobSystem::ParallelFor(ClusterCount, ClusterX * ClusterY, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t c = begin; c < end; c++) {
+                if (!m_ClusterCounts[c])
+                    continue;
+                uint32_t* slots = &m_LightIndices[m_ClusterRanges[c * 2]];
+                for (uint32_t light : m_SliceLights[c / (ClusterX * ClusterY)]) {
+                    if (SphereIntersectsAABB(viewLights[light], m_ClusterMin[c], m_ClusterMax[c]))
+                        *slots++ = light;
+                }
+            }
+        });
+
+        PointLight dummy;
+        Upload(m_LightSSBO, lightCount ? (const void*)m_Lights.data() : (const void*)&dummy,
+               std::max(lightCount, 1u) * sizeof(PointLight), m_LightCapacity);
+        Upload(m_ClusterSSBO, m_ClusterRanges.data(), m_ClusterRanges.size() * sizeof(uint32_t), m_ClusterCapacity);
+        Upload(m_IndexSSBO, m_LightIndices.data(), m_LightIndices.size() * sizeof(uint32_t), m_IndexCapacity);
+
+        m_Stats.LightCount = lightCount;
+        m_Stats.LightIndexCount = total;
+        m_Stats.MaxLightsInCluster = maxInCluster;
+        m_Stats.CullMs = std::chrono::duration<float, std::milli>(
+            std::chrono::high_resolution_clock::now() - start).count();
+    }
+
+    void ClusteredLighting::Upload(uint32_t buffer, const void* data, size_t size, size_t& capacity) {
+        // Grow geometrically so the light count can ramp up without reallocating every frame
+        if (size > capacity) {
+            size_t grown = std::max(size, capacity * 2);
+            MemoryTracker::TrackGpuAlloc(MemTag::Renderer, (int64_t)(grown - capacity));
+            capacity = grown;
+        }
+
+        // Re-specifying the store orphans it, so the driver does not stall on last frame's reads
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, buffer);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, capacity, nullptr, GL_DYNAMIC_DRAW);
+        glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, size, data);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    }
+
+    void ClusteredLighting::BeginShadingTimer() {
+        // Skip timing rather than wait if every slot is still in flight
+        m_Timing = !m_Slots[m_Head].Pending;
+        if (m_Timing)
+            glQueryCounter(m_Slots[m_Head].Queries[0], GL_TIMESTAMP);
+    }
+
+    void ClusteredLighting::EndShadingTimer() {
+        if (m_Timing) {
+            Slot& slot = m_Slots[m_Head];
+            glQueryCounter(slot.Queries[1], GL_TIMESTAMP);
+            slot.Pending = true;
+            m_Head = (m_Head + 1) % RingSize;
+            m_Timing = false;
+        }
+        PollTimings();
+    }
+
+    void ClusteredLighting::PollTimings() {
+        // Oldest in-flight slot first; stop at the first one the GPU has not finished
+        for (uint32_t i = 0; i < RingSize; i++) {
+            Slot& slot = m_Slots[(m_Head + i) % RingSize];
+            if (!slot.Pending)
+                continue;
+            GLint available = 0;
+            glGetQueryObjectiv(slot.Queries[1], GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available)
+                break;
+
+            GLuint64 begin = 0, end = 0;
+            glGetQueryObjectui64v(slot.Queries[0], GL_QUERY_RESULT, &begin);
+            glGetQueryObjectui64v(slot.Queries[1], GL_QUERY_RESULT, &end);
+            slot.Pending = false;
+            m_Stats.ShadingGpuMs = (float)((double)(end - begin) / 1.0e6);
+        }
+    }
+
+    void ClusteredLighting::Bind() const {
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, LightBinding, m_LightSSBO);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, ClusterBinding, m_ClusterSSBO);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, IndexBinding, m_IndexSSBO);
+    }
+
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace Groove {
+
+    class Camera;
+
+    // std430 layout, matches PointLight in the forward shader
+    struct PointLight {
+        glm::vec4 PositionRadius{ 0.0f, 0.0f, 0.0f, 5.0f }; // xyz world position, w falloff radius
+        glm::vec4 ColorIntensity{ 1.0f, 1.0f, 1.0f, 1.0f }; // rgb colour, a intensity
+    };
+
+    struct ClusterStats {
+        uint32_t LightCount = 0;
+        uint32_t LightIndexCount = 0;   // total light references over all clusters
+        uint32_t MaxLightsInCluster = 0;
+        float    CullMs = 0.0f;
+        float    ShadingGpuMs = 0.0f;   // forward pass on the GPU (timestamps), a frame or two old
+    };
+
+    // Splits the view frustum into ClusterX * ClusterY screen tiles and ClusterZ exponential depth
+    // slices, assigns lights to the clusters they touch on the JobSystem, and uploads
+    // lights / per-cluster ranges / light indices as SSBOs for the forward shader. The index list
+    // is sized from the actual per-cluster counts, so no light is ever dropped from a cluster.
+    class ClusteredLighting {
+    public:
+        static const uint32_t ClusterX = 16;
+        static const uint32_t ClusterY = 9;
+        static const uint32_t ClusterZ = 24;
+        static const uint32_t ClusterCount = ClusterX * ClusterY * ClusterZ;
+        static const uint32_t RingSize = 3;
+
+        // SSBO binding points used by the shader
+        static const uint32_t LightBinding = 0;
+        static const uint32_t ClusterBinding = 1;
+        static const uint32_t IndexBinding = 2;
+
+        ClusteredLighting();
+        ~ClusteredLighting();
+
+        void SetLights(const PointLight* lights, uint32_t count);
+
+        // Cull lights against the camera's clusters and upload everything for this frame.
+        // Clusters are defined in NDC, so the viewport size only matters to the shader.
+        void Update(const Camera& cam);
+
+        void Bind() const;
+
+        // GPU timestamps around the forward pass, so lighting cost is measured without the
+        // present wait that dominates frame time under vsync
+        void BeginShadingTimer();
+        void EndShadingTimer();
+
+        uint32_t GetLightCount() const { return (uint32_t)m_Lights.size(); }
+        const ClusterStats& GetStats() const { return m_Stats; }
+
+    private:
+        void RebuildClusterBounds(const glm::mat4& proj, float zNear, float zFar);
+        static void Upload(uint32_t buffer, const void* data, size_t size, size_t& capacity);
+        void PollTimings();
+
+        std::vector<PointLight> m_Lights;
+
+        // View-space AABBs of every cluster, rebuilt only when the projection changes
+        std::vector<glm::vec3> m_ClusterMin, m_ClusterMax;
+        glm::mat4 m_CachedProj{ 0.0f };
+
+        // Scratch, kept between frames to avoid reallocating
+        std::vector<glm::vec4> m_ViewLights;               // view-space centre + radius
+        std::vector<std::vector<uint32_t>> m_SliceLights;  // lights overlapping each depth slice
+        std::vector<uint32_t> m_ClusterCounts;
+        std::vector<uint32_t> m_ClusterRanges;              // (offset, count) pairs
+        std::vector<uint32_t> m_LightIndices;
+
+        uint32_t m_LightSSBO = 0, m_ClusterSSBO = 0, m_IndexSSBO = 0;
+        size_t m_LightCapacity = 0, m_ClusterCapacity = 0, m_IndexCapacity = 0;
+
+        struct Slot {
+            uint32_t Queries[2] = {};
+            bool     Pending = false;
+        };
+        Slot m_Slots[RingSize];
+        uint32_t m_Head = 0;
+        bool m_Timing = false;
+
+        ClusterStats m_Stats;
+    };
+
+}
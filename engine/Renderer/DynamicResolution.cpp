@@ -0,0 +1,212 @@
+#include "DynamicResolution.h"
+#include "Shader.h"
+#include "../Utils/Logger.h"
+#include "../Utils/MemoryTracker.h"
+
+#include <glad/glad.h>
+#include <algorithm>
+#include <cmath>
+
+// Full-screen triangle from gl_VertexID, no vertex buffer
+static const char* upscaleVertexSrc = R"(
+#version 450 core
+
+out vec2 v_UV;
+
+void main()
+{
+    vec2 pos = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+    v_UV = pos;
+    gl_Position = vec4(pos * 2.0 - 1.0, 0.0, 1.0);
+}
+)";
+
+// Bilinear upscale followed by contrast-adaptive sharpening over the source texel's
+// neighbours: the weight falls off where the neighbourhood already spans a wide range,
+// so edges do not ring while soft upscaled detail gets its contrast back.
+static const char* upscaleFragmentSrc = R"(
+#version 450 core
+
+in vec2 v_UV;
+
+uniform sampler2D u_Scene;
+uniform vec2  u_UVScale;        // rendered size / target size
+uniform vec2  u_UVMax;          // centre of the last rendered texel, keeps taps inside the rect
+uniform vec2  u_SourceTexel;    // 1 / target size
+uniform float u_Sharpness;
+
+out vec4 FragColor;
+
+vec3 Tap(vec2 uv)
+{
+    return texture(u_Scene, min(uv, u_UVMax)).rgb;
+}
+
+void main()
+{
+    vec2 uv = v_UV * u_UVScale;
+    vec3 c = Tap(uv);
+    vec3 n = Tap(uv + vec2(0.0, u_SourceTexel.y));
+    vec3 s = Tap(uv - vec2(0.0, u_SourceTexel.y));
+    vec3 e = Tap(uv + vec2(u_SourceTexel.x, 0.0));
+    vec3 w = Tap(uv - vec2(u_SourceTexel.x, 0.0));
+
+    vec3 lo = min(c, min(min(n, s), min(e, w)));
+    vec3 hi = max(c, max(max(n, s), max(e, w)));
+    vec3 amp = sqrt(clamp(min(lo, 1.0 - hi) / max(hi, vec3(1e-4)), 0.0, 1.0));
+    vec3 weight = -amp * (0.2 * u_Sharpness);
+
+    vec3 color = (c + (n + s + e + w) * weight) / (1.0 + 4.0 * weight);
+    FragColor = vec4(clamp(color, 0.0, 1.0), 1.0);
+}
+)";
+
+namespace Groove {
+
+    const uint32_t DynamicResolution::RingSize;
+
+    DynamicResolution::DynamicResolution() {
+        m_UpscaleShader = new Shader(upscaleVertexSrc, upscaleFragmentSrc);
+        // The full-screen triangle has no attributes, but core profile still needs a VAO bound
+        glGenVertexArrays(1, &m_VAO);
+        for (Slot& slot : m_Slots)
+            glGenQueries(2, slot.Queries);
+    }
+
+    DynamicResolution::~DynamicResolution() {
+        DestroyTargets();
+        for (Slot& slot : m_Slots)
+            glDeleteQueries(2, slot.Queries);
+        glDeleteVertexArrays(1, &m_VAO);
+        delete m_UpscaleShader;
+    }
+
+    void DynamicResolution::CreateTargets(uint32_t width, uint32_t height) {
+        m_TargetWidth = width;
+        m_TargetHeight = height;
+
+        glGenFramebuffers(1, &m_FBO);
+        glBindFramebuffer(GL_FRAMEBUFFER, m_FBO);
+
+        glGenTextures(1, &m_ColorTexture);
+        glBindTexture(GL_TEXTURE_2D, m_ColorTexture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, (GLsizei)width, (GLsizei)height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_ColorTexture, 0);
+
+        glGenRenderbuffers(1, &m_DepthRBO);
+        glBindRenderbuffer(GL_RENDERBUFFER, m_DepthRBO);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, (GLsizei)width, (GLsizei)height);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, m_DepthRBO);
+
+        // RGBA8 colour + 24-bit depth (stored as 32 bits on most drivers)
+        MemoryTracker::TrackGpuAlloc(MemTag::Renderer, (int64_t)width * height * 8);
+
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+            Logger::Error("DynamicResolution framebuffer is incomplete!");
+
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+
+    void DynamicResolution::DestroyTargets() {
+        if (!m_FBO)
+            return;
+        glDeleteFramebuffers(1, &m_FBO);
+        glDeleteTextures(1, &m_ColorTexture);
+        glDeleteRenderbuffers(1, &m_DepthRBO);
+        MemoryTracker::TrackGpuFree(MemTag::Renderer, (int64_t)m_TargetWidth * m_TargetHeight * 8);
+        m_FBO = m_ColorTexture = m_DepthRBO = 0;
+    }
+
+    void DynamicResolution::BeginFrame(int windowWidth, int windowHeight) {
+        Settings.MinScale = std::min(std::max(Settings.MinScale, 0.1f), 1.0f);
+        Settings.MaxScale = std::min(std::max(Settings.MaxScale, Settings.MinScale), 2.0f);
+        if (windowWidth != m_WindowWidth || windowHeight != m_WindowHeight || Settings.MaxScale != m_TargetMaxScale) {
+            DestroyTargets();
+            m_WindowWidth = windowWidth;
+            m_WindowHeight = windowHeight;
+            m_TargetMaxScale = Settings.MaxScale;
+            CreateTargets((uint32_t)std::max(1.0f, std::ceil(windowWidth * Settings.MaxScale)),
+                          (uint32_t)std::max(1.0f, std::ceil(windowHeight * Settings.MaxScale)));
+        }
+
+        m_Scale = std::min(std::max(m_Scale, Settings.MinScale), Settings.MaxScale);
+        m_Stats.Scale = m_Scale;
+        m_Stats.RenderWidth = std::min(m_TargetWidth, (uint32_t)std::max(1.0f, windowWidth * m_Scale + 0.5f));
+        m_Stats.RenderHeight = std::min(m_TargetHeight, (uint32_t)std::max(1.0f, windowHeight * m_Scale + 0.5f));
+
+        m_Timing = false;
+        glBindFramebuffer(GL_FRAMEBUFFER, m_FBO);
+        glViewport(0, 0, (GLsizei)m_Stats.RenderWidth, (GLsizei)m_Stats.RenderHeight);
+    }
+
+    void DynamicResolution::BeginGpuTiming() {
+        // Skip timing this frame rather than wait if every slot is still in flight
+        Slot& slot = m_Slots[m_Head];
+        m_Timing = !slot.Pending;
+        if (m_Timing) {
+            glQueryCounter(slot.Queries[0], GL_TIMESTAMP);
+            slot.Scale = m_Scale;
+        }
+    }
+
+    void DynamicResolution::EndFrame() {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glViewport(0, 0, m_WindowWidth, m_WindowHeight);
+        glDisable(GL_DEPTH_TEST);
+
+        m_UpscaleShader->Bind();
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, m_ColorTexture);
+        m_UpscaleShader->SetUniform1i("u_Scene", 0);
+        m_UpscaleShader->SetUniform2f("u_UVScale", (float)m_Stats.RenderWidth / m_TargetWidth,
+                                      (float)m_Stats.RenderHeight / m_TargetHeight);
+        m_UpscaleShader->SetUniform2f("u_UVMax", (m_Stats.RenderWidth - 0.5f) / m_TargetWidth,
+                                      (m_Stats.RenderHeight - 0.5f) / m_TargetHeight);
+        m_UpscaleShader->SetUniform2f("u_SourceTexel", 1.0f / m_TargetWidth, 1.0f / m_TargetHeight);
+        m_UpscaleShader->SetUniform1f("u_Sharpness", std::min(std::max(Settings.Sharpness, 0.0f), 1.0f));
+        glBindVertexArray(m_VAO);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        glBindVertexArray(0);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glEnable(GL_DEPTH_TEST);
+
+        if (m_Timing) {
+            Slot& slot = m_Slots[m_Head];
+            glQueryCounter(slot.Queries[1], GL_TIMESTAMP);
+            slot.Pending = true;
+            m_Head = (m_Head + 1) % RingSize;
+        }
+        PollTimings();
+    }
+
+    void DynamicResolution::PollTimings() {
+        // Oldest in-flight slot first; stop at the first one the GPU has not finished
+        for (uint32_t i = 0; i < RingSize; i++) {
+            Slot& slot = m_Slots[(m_Head + i) % RingSize];
+            if (!slot.Pending)
+                continue;
+            GLint available = 0;
+            glGetQueryObjectiv(slot.Queries[1], GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available)
+                break;
+
+            GLuint64 begin = 0, end = 0;
+            glGetQueryObjectui64v(slot.Queries[0], GL_QUERY_RESULT, &begin);
+            glGetQueryObjectui64v(slot.Queries[1], GL_QUERY_RESULT, &end);
+            slot.Pending = false;
+            m_Stats.GpuMs = (float)((double)(end - begin) / 1.0e6);
+
+            // The scale that would have just fit the budget for that frame's content
+            float budget = Settings.TargetFrameMs * Settings.Headroom;
+            float ideal = slot.Scale * std::sqrt(budget / std::max(m_Stats.GpuMs, 0.01f));
+            float gain = ideal < m_Scale ? 0.5f : 0.1f;
+            m_Scale = std::min(std::max(m_Scale + (ideal - m_Scale) * gain, Settings.MinScale), Settings.MaxScale);
+        }
+    }
+
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Groove {
+
+    class Shader;
+
+    struct DynamicResolutionSettings {
+        float TargetFrameMs = 16.6f;   // GPU budget for scene + upscale
+        float Headroom = 0.9f;         // aim this far under the budget so small spikes still fit
+        float MinScale = 0.5f;
+        float MaxScale = 1.0f;
+        float Sharpness = 0.5f;        // 0 = plain bilinear, 1 = strongest sharpening
+    };
+
+    struct DynamicResolutionStats {
+        float    Scale = 1.0f;         // per axis, used for the frame being rendered
+        uint32_t RenderWidth = 0;
+        uint32_t RenderHeight = 0;
+        float    GpuMs = 0.0f;         // scene + upscale on the GPU, a frame or two old
+    };
+
+    // Renders the scene into an offscreen target at a fraction of the window size, then
+    // upscales it into the default framebuffer with a contrast-adaptive sharpening pass, so
+    // ImGui drawn afterwards stays at native resolution. GPU timestamps around the scene passes drive
+    // the scale: cost is taken as proportional to pixel count, so the controller moves toward
+    // scale * sqrt(budget / measured), dropping quickly on overload and recovering slowly.
+    // The target is allocated at MaxScale and the scene uses a sub-rectangle of it, so
+    // changing the scale never reallocates.
+    class DynamicResolution {
+    public:
+        static const uint32_t RingSize = 3;
+
+        DynamicResolution();
+        ~DynamicResolution();
+
+        DynamicResolution(const DynamicResolution&) = delete;
+        DynamicResolution& operator=(const DynamicResolution&) = delete;
+
+        // Binds the offscreen target and sets the viewport to the scaled size
+        void BeginFrame(int windowWidth, int windowHeight);
+        // Start timestamp of the measured GPU work. Call after the frame's CPU work, right before the
+        // first scene draw: an earlier timestamp would also count the GPU idling while the CPU
+        // prepares the frame, and the controller would drop resolution for a CPU bottleneck.
+        // Frames without this call are not timed.
+        void BeginGpuTiming();
+        // Upscales into the default framebuffer and restores the full-window viewport
+        void EndFrame();
+
+        uint32_t GetRenderWidth() const { return m_Stats.RenderWidth; }
+        uint32_t GetRenderHeight() const { return m_Stats.RenderHeight; }
+
+        DynamicResolutionSettings Settings;
+        const DynamicResolutionStats& GetStats() const { return m_Stats; }
+
+    private:
+        void CreateTargets(uint32_t width, uint32_t height);
+        void DestroyTargets();
+        void PollTimings();
+
+        int m_WindowWidth = 0, m_WindowHeight = 0;
+        uint32_t m_TargetWidth = 0, m_TargetHeight = 0;   // allocated size (window * MaxScale)
+        float m_TargetMaxScale = 0.0f;
+        uint32_t m_FBO = 0, m_ColorTexture = 0, m_DepthRBO = 0;
+        uint32_t m_VAO = 0;
+        Shader* m_UpscaleShader = nullptr;
+        float m_Scale = 1.0f;
+
+        // Timestamp pair per frame in flight, with the scale that frame was rendered at
+        struct Slot {
+            uint32_t Queries[2] = {};
+            float    Scale = 1.0f;
+            bool     Pending = false;
+        };
+        Slot m_Slots[RingSize];
+        uint32_t m_Head = 0;
+        bool m_Timing = false;
+
+        DynamicResolutionStats m_Stats;
+    };
+
+}
@@ -0,0 +1,150 @@
+#include "GPUPicker.h"
+#include "../Utils/Logger.h"
+#include "../Utils/MemoryTracker.h"
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+namespace Groove {
+
+    GPUPicker::GPUPicker(int width, int height)
+        : m_Width(width), m_Height(height) {
+        CreateTargets();
+
+        for (Slot& slot : m_Slots) {
+            glGenBuffers(1, &slot.PBO);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.PBO);
+            glBufferData(GL_PIXEL_PACK_BUFFER, sizeof(uint32_t), nullptr, GL_STREAM_READ);
+        }
+        MemoryTracker::TrackGpuAlloc(MemTag::Renderer, RingSize * sizeof(uint32_t));
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+
+    GPUPicker::~GPUPicker() {
+        for (Slot& slot : m_Slots) {
+            if (slot.Fence)
+                glDeleteSync((GLsync)slot.Fence);
+            glDeleteBuffers(1, &slot.PBO);
+        }
+        MemoryTracker::TrackGpuFree(MemTag::Renderer, RingSize * sizeof(uint32_t));
+        DestroyTargets();
+    }
+
+    void GPUPicker::CreateTargets() {
+        glGenFramebuffers(1, &m_FBO);
+        glBindFramebuffer(GL_FRAMEBUFFER, m_FBO);
+
+        glGenTextures(1, &m_IDTexture);
+        glBindTexture(GL_TEXTURE_2D, m_IDTexture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_R32UI, m_Width, m_Height, 0, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_IDTexture, 0);
+
+        glGenRenderbuffers(1, &m_DepthRBO);
+        glBindRenderbuffer(GL_RENDERBUFFER, m_DepthRBO);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, m_Width, m_Height);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, m_DepthRBO);
+
+        // R32UI colour + 24-bit depth (stored as 32 bits on most drivers)
+        MemoryTracker::TrackGpuAlloc(MemTag::Renderer, (int64_t)m_Width * m_Height * 8);
+
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+            Logger::Error("GPUPicker framebuffer is incomplete!");
+
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+
+    void GPUPicker::DestroyTargets() {
+        glDeleteFramebuffers(1, &m_FBO);
+        glDeleteTextures(1, &m_IDTexture);
+        glDeleteRenderbuffers(1, &m_DepthRBO);
+        MemoryTracker::TrackGpuFree(MemTag::Renderer, (int64_t)m_Width * m_Height * 8);
+        m_FBO = m_IDTexture = m_DepthRBO = 0;
+    }
+
+    void GPUPicker::Resize(int width, int height) {
+        if (width == m_Width && height == m_Height)
+            return;
+        DestroyTargets();
+        m_Width = width;
+        m_Height = height;
+        CreateTargets();
+    }
+
+    bool GPUPicker::BeginPass(double cursorX, double cursorY, uint64_t frame) {
+        if (m_Pending == RingSize)
+            return false;
+
+        // GL's origin is bottom-left
+        m_PixelX = (int)cursorX;
+        m_PixelY = m_Height - 1 - (int)cursorY;
+        if (m_PixelX < 0 || m_PixelY < 0 || m_PixelX >= m_Width || m_PixelY >= m_Height)
+            return false;
+        m_PassFrame = frame;
+
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &m_SavedFramebuffer);
+        glGetIntegerv(GL_VIEWPORT, m_SavedViewport);
+        glBindFramebuffer(GL_FRAMEBUFFER, m_FBO);
+        glViewport(0, 0, m_Width, m_Height);
+        glEnable(GL_SCISSOR_TEST);
+        glScissor(m_PixelX, m_PixelY, 1, 1);
+
+        // Clears honour the scissor, so only the cursor pixel is touched. 0 means "nothing".
+        const GLuint noEntity[4] = { 0, 0, 0, 0 };
+        glClearBufferuiv(GL_COLOR, 0, noEntity);
+        glClear(GL_DEPTH_BUFFER_BIT);
+        return true;
+    }
+
+    void GPUPicker::EndPass() {
+        Slot& slot = m_Slots[m_Head];
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.PBO);
+        glReadBuffer(GL_COLOR_ATTACHMENT0);
+        glReadPixels(m_PixelX, m_PixelY, 1, 1, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        slot.Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        slot.Frame = m_PassFrame;
+        slot.RequestTime = glfwGetTime();
+
+        m_Head = (m_Head + 1) % RingSize;
+        m_Pending++;
+
+        glDisable(GL_SCISSOR_TEST);
+        glBindFramebuffer(GL_FRAMEBUFFER, (GLuint)m_SavedFramebuffer);
+        glViewport(m_SavedViewport[0], m_SavedViewport[1], m_SavedViewport[2], m_SavedViewport[3]);
+    }
+
+    bool GPUPicker::PollResult(uint64_t currentFrame, PickResult& out) {
+        if (m_Pending == 0)
+            return false;
+
+        Slot& slot = m_Slots[(m_Head + RingSize - m_Pending) % RingSize];
+
+        // Zero timeout: just ask whether the copy is done
+        GLenum status = glClientWaitSync((GLsync)slot.Fence, 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+            return false;
+
+        uint32_t id = 0;
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.PBO);
+        if (void* mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, sizeof(uint32_t), GL_MAP_READ_BIT)) {
+            id = *static_cast<const uint32_t*>(mapped);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        glDeleteSync((GLsync)slot.Fence);
+        slot.Fence = nullptr;
+        m_Pending--;
+
+        out.Hit = id != 0;
+        out.EntityID = id ? id - 1 : 0;
+        out.RequestFrame = slot.Frame;
+        out.FramesLatency = (uint32_t)(currentFrame - slot.Frame);
+        out.LatencyMs = (float)((glfwGetTime() - slot.RequestTime) * 1000.0);
+        return true;
+    }
+
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Groove {
+
+    struct PickResult {
+        bool     Hit = false;
+        uint32_t EntityID = 0;
+        uint64_t RequestFrame = 0;   // frame the pick was rendered in
+        uint32_t FramesLatency = 0;  // frames between request and result
+        float    LatencyMs = 0.0f;   // wall time between request and result
+    };
+
+    // ID-buffer picking: entity ids are rendered into an R32UI target with a 1x1 scissor at the
+    // cursor, copied into a pixel buffer object and fenced. Results are collected one or two
+    // frames later once the fence has signalled, so the CPU never waits on the GPU.
+    class GPUPicker {
+    public:
+        static const uint32_t RingSize = 3;
+
+        GPUPicker(int width, int height);
+        ~GPUPicker();
+
+        GPUPicker(const GPUPicker&) = delete;
+        GPUPicker& operator=(const GPUPicker&) = delete;
+
+        void Resize(int width, int height);
+
+        // Binds the ID target scissored to the cursor pixel (window coords, top-left origin).
+        // Returns false (and binds nothing) when every readback slot is still in flight.
+        bool BeginPass(double cursorX, double cursorY, uint64_t frame);
+        // Queues the async readback and restores the default framebuffer
+        void EndPass();
+
+        // Non-blocking; returns true when the oldest pending pick has landed
+        bool PollResult(uint64_t currentFrame, PickResult& out);
+
+        uint32_t GetPendingCount() const { return m_Pending; }
+
+    private:
+        void CreateTargets();
+        void DestroyTargets();
+
+        struct Slot {
+            uint32_t PBO = 0;
+            void*    Fence = nullptr;    // GLsync
+            uint64_t Frame = 0;
+            double   RequestTime = 0.0;
+        };
+
+        int m_Width, m_Height;
+        uint32_t m_FBO = 0, m_IDTexture = 0, m_DepthRBO = 0;
+        int m_PixelX = 0, m_PixelY = 0;
+        int m_SavedFramebuffer = 0;       // restored by EndPass (the scene may render offscreen)
+        int m_SavedViewport[4] = {};
+
+        Slot m_Slots[RingSize];
+        uint32_t m_Head = 0;     // next slot to write
+        uint32_t m_Pending = 0;  // slots in flight, oldest at (m_Head - m_Pending)
+        uint64_t m_PassFrame = 0;
+    };
+
+}
@@ -1,5 +1,6 @@
 #include "ImGuiLayer.h"  
 #include "../Utils/Logger.h"  
+#include "../Utils/MemoryTracker.h"
 
 // ImGui core  
 #include <imgui.h>  
@@ -9,10 +10,20 @@
 
 namespace Groove {  
 
+    // Route ImGui's heap through the tracker so its memory shows up under MemTag::ImGui
+    static void* ImGuiTrackedAlloc(size_t size, void*) {
+        return MemoryTracker::TaggedAlloc(size, MemTag::ImGui);
+    }
+
+    static void ImGuiTrackedFree(void* p, void*) {
+        MemoryTracker::TaggedFree(p);
+    }
+
     void ImGuiLayer::Init(GLFWwindow* window) {  
         m_Window = window;  
 
         IMGUI_CHECKVERSION();  
+        ImGui::SetAllocatorFunctions(ImGuiTrackedAlloc, ImGuiTrackedFree);
         ImGui::CreateContext();  
         ImGuiIO& io = ImGui::GetIO();  
         io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard; // Keyboard controls  
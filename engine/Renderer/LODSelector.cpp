@@ -0,0 +1,72 @@
+#include "LODSelector.h"
+#include "../src/Transform.hpp"
+#include "../Utils/JobSystem.h"
+#include <Camera.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
+namespace Groove {
+
+    void LODSelector::Select(const Transform* transforms, uint32_t count,
+                             const MeshLODChain& chain, float meshRadius,
+                             const Camera& cam, float viewportHeight) {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        if (m_CurrentLOD.size() != count)
+            m_CurrentLOD.assign(count, 0);
+
+        const uint32_t levelCount = chain.GetLevelCount();
+        if (levelCount == 0 || count == 0) {
+            m_Stats = LODSelectionStats();
+            return;
+        }
+
+        // proj[1][1] = 1 / tan(fovY / 2): world size at distance 1 -> pixels
+        const float projScale = cam.GetProjectionMatrix()[1][1] * viewportHeight * 0.5f;
+        const glm::vec3 camPos = cam.GetPosition();
+        const float threshold = Settings.PixelErrorThreshold;
+        const float coarsenThreshold = threshold * (1.0f - Settings.Hysteresis);
+        const MeshLOD* levels = chain.Levels.data();
+        uint8_t* current = m_CurrentLOD.data();
+
+        std::atomic<uint64_t> selectedTris{ 0 };
+
+        JobSystem::ParallelFor(count, Settings.BatchSize, [&](uint32_t begin, uint32_t end) {
+            uint64_t localTris = 0;
+            for (uint32_t i = begin; i < end; i++) {
+                const Transform& t = transforms[i];
+                float maxScale = std::max(std::abs(t.Scale.x), std::max(std::abs(t.Scale.y), std::abs(t.Scale.z)));
+                float distance = glm::length(t.Position - camPos) - meshRadius * maxScale;
+                // Inside the bounding sphere: always full detail
+                float pixelsPerUnit = distance > 1e-4f ? projScale * maxScale / distance : 1e30f;
+
+                uint32_t lod = current[i];
+                if (lod >= levelCount)
+                    lod = levelCount - 1;
+
+                if (levels[lod].Error * pixelsPerUnit > threshold) {
+                    // Too coarse: refine until the error fits
+                    while (lod > 0 && levels[lod].Error * pixelsPerUnit > threshold)
+                        lod--;
+                } else {
+                    // Only coarsen when the next level is comfortably under the threshold
+                    while (lod + 1 < levelCount && levels[lod + 1].Error * pixelsPerUnit <= coarsenThreshold)
+                        lod++;
+                }
+
+                current[i] = (uint8_t)lod;
+                localTris += levels[lod].IndexCount / 3;
+            }
+            selectedTris.fetch_add(localTris, std::memory_order_relaxed);
+        });
+
+        m_Stats.ObjectCount = count;
+        m_Stats.TrianglesFullDetail = (uint64_t)count * (levels[0].IndexCount / 3);
+        m_Stats.TrianglesSelected = selectedTris.load();
+        m_Stats.SelectionMs = std::chrono::duration<float, std::milli>(
+            std::chrono::high_resolution_clock::now() - start).count();
+    }
+
+}
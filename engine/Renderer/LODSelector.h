@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Mesh.h"
+#include <cstdint>
+#include <vector>
+
+namespace Groove {
+
+    struct Transform;
+    class Camera;
+
+    struct LODSelectionSettings {
+        float    PixelErrorThreshold = 1.0f; // max projected error (pixels) a level may have
+        float    Hysteresis = 0.25f;         // a coarser level must beat the threshold by this fraction
+        uint32_t BatchSize = 2048;           // objects per parallel job
+    };
+
+    struct LODSelectionStats {
+        uint32_t ObjectCount = 0;
+        uint64_t TrianglesFullDetail = 0;
+        uint64_t TrianglesSelected = 0;
+        float    SelectionMs = 0.0f;
+
+        uint64_t GetTrianglesSaved() const { return TrianglesFullDetail - TrianglesSelected; }
+    };
+
+    // Picks a level per object from the screen-space size of each level's geometric error.
+    // Keeps the previous choice per object so levels do not flicker around the threshold.
+    class LODSelector {
+    public:
+        // meshRadius is the bounding-sphere radius of LOD 0 in object space (mesh centred on origin)
+        void Select(const Transform* transforms, uint32_t count,
+                    const MeshLODChain& chain, float meshRadius,
+                    const Camera& cam, float viewportHeight);
+
+        uint32_t GetLOD(uint32_t object) const { return m_CurrentLOD[object]; }
+        const LODSelectionStats& GetStats() const { return m_Stats; }
+
+        LODSelectionSettings Settings;
+
+    private:
+        std::vector<uint8_t> m_CurrentLOD;
+        LODSelectionStats m_Stats;
+    };
+
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace Groove {
+
+    // One level of detail inside a MeshLODChain: a range of the chain's index array
+    struct MeshLOD {
+        uint32_t IndexOffset = 0;   // first index into MeshLODChain::Indices
+        uint32_t IndexCount = 0;
+        float    Error = 0.0f;      // object-space geometric error vs LOD 0
+    };
+
+    // CPU-side indexed triangle mesh (positions only, like the cube in Renderer.cpp)
+    struct Mesh {
+        std::vector<glm::vec3> Positions;
+        std::vector<uint32_t>  Indices;
+
+        uint32_t GetTriangleCount() const { return (uint32_t)(Indices.size() / 3); }
+    };
+
+    // All LODs share the mesh's vertex buffer; every level is just another index range,
+    // so the whole chain lives in a single IBO next to the original geometry.
+    struct MeshLODChain {
+        std::vector<uint32_t> Indices;   // LOD 0 first, then each coarser level
+        std::vector<MeshLOD>  Levels;
+
+        uint32_t GetLevelCount() const { return (uint32_t)Levels.size(); }
+    };
+
+}
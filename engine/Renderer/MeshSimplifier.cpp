@@ -0,0 +1,227 @@
+#include "MeshSimplifier.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Groove {
+
+    // Symmetric 4x4 error quadric, upper triangle only
+    struct Quadric {
+        double a00 = 0, a01 = 0, a02 = 0, a03 = 0;
+        double a11 = 0, a12 = 0, a13 = 0;
+        double a22 = 0, a23 = 0;
+        double a33 = 0;
+
+        void AddPlane(double a, double b, double c, double d) {
+            a00 += a * a; a01 += a * b; a02 += a * c; a03 += a * d;
+            a11 += b * b; a12 += b * c; a13 += b * d;
+            a22 += c * c; a23 += c * d;
+            a33 += d * d;
+        }
+
+        Quadric& operator+=(const Quadric& q) {
+            a00 += q.a00; a01 += q.a01; a02 += q.a02; a03 += q.a03;
+            a11 += q.a11; a12 += q.a12; a13 += q.a13;
+            a22 += q.a22; a23 += q.a23;
+            a33 += q.a33;
+            return *this;
+        }
+
+        // v^T Q v with v = (x, y, z, 1)
+        double Evaluate(const glm::vec3& p) const {
+            double x = p.x, y = p.y, z = p.z;
+            return a00 * x * x + 2.0 * a01 * x * y + 2.0 * a02 * x * z + 2.0 * a03 * x
+                 + a11 * y * y + 2.0 * a12 * y * z + 2.0 * a13 * y
+                 + a22 * z * z + 2.0 * a23 * z
+                 + a33;
+        }
+    };
+
+    struct CollapseCandidate {
+        uint32_t From, To;
+        double   Cost;
+    };
+
+    static glm::vec3 TriangleNormal(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c) {
+        return glm::cross(b - a, c - a);
+    }
+
+    // Would moving 'from' onto 'to' flip any triangle around 'from'?
+    static bool CollapseFlipsTriangle(uint32_t from, uint32_t to,
+                                      const std::vector<glm::vec3>& positions,
+                                      const std::vector<uint32_t>& tris,
+                                      const std::vector<uint32_t>& adjOffsets,
+                                      const std::vector<uint32_t>& adjTris) {
+        for (uint32_t k = adjOffsets[from]; k < adjOffsets[from + 1]; k++) {
+            const uint32_t* t = &tris[adjTris[k] * 3];
+            if (t[0] == to || t[1] == to || t[2] == to)
+                continue; // becomes degenerate and gets dropped
+
+            glm::vec3 p[3], q[3];
+            for (int i = 0; i < 3; i++) {
+                p[i] = positions[t[i]];
+                q[i] = t[i] == from ? positions[to] : p[i];
+            }
+            if (glm::dot(TriangleNormal(p[0], p[1], p[2]), TriangleNormal(q[0], q[1], q[2])) <= 0.0f)
+                return true;
+        }
+        return false;
+    }
+
+    std::vector<uint32_t> MeshSimplifier::Simplify(const std::vector<glm::vec3>& positions,
+                                                   const std::vector<uint32_t>& indices,
+                                                   uint32_t targetIndexCount,
+                                                   float* outError) {
+        const uint32_t vertexCount = (uint32_t)positions.size();
+        std::vector<uint32_t> tris = indices;
+        double maxCost = 0.0;
+
+        // Per-vertex quadrics from the planes of the incident triangles
+        std::vector<Quadric> quadrics(vertexCount);
+        for (size_t i = 0; i + 2 < tris.size(); i += 3) {
+            const glm::vec3& a = positions[tris[i]];
+            const glm::vec3& b = positions[tris[i + 1]];
+            const glm::vec3& c = positions[tris[i + 2]];
+            glm::vec3 n = TriangleNormal(a, b, c);
+            float len = glm::length(n);
+            if (len <= 0.0f)
+                continue;
+            n /= len;
+            double d = -glm::dot(n, a);
+            for (int k = 0; k < 3; k++)
+                quadrics[tris[i + k]].AddPlane(n.x, n.y, n.z, d);
+        }
+
+        std::vector<CollapseCandidate> candidates;
+        std::vector<uint32_t> adjOffsets(vertexCount + 1);
+        std::vector<uint32_t> adjTris;
+        std::vector<uint32_t> remap(vertexCount);
+        std::vector<uint8_t>  locked(vertexCount);
+
+        // Each pass collapses the cheapest edges that do not touch each other, then rebuilds
+        while (tris.size() > targetIndexCount) {
+            const uint32_t triCount = (uint32_t)(tris.size() / 3);
+
+            // Vertex -> triangle adjacency (CSR)
+            std::fill(adjOffsets.begin(), adjOffsets.end(), 0u);
+            for (uint32_t idx : tris)
+                adjOffsets[idx + 1]++;
+            for (uint32_t v = 0; v < vertexCount; v++)
+                adjOffsets[v + 1] += adjOffsets[v];
+            adjTris.resize(tris.size());
+            {
+                std::vector<uint32_t> cursor(adjOffsets.begin(), adjOffsets.end() - 1);
+                for (uint32_t t = 0; t < triCount; t++)
+                    for (int k = 0; k < 3; k++)
+                        adjTris[cursor[tris[t * 3 + k]]++] = t;
+            }
+
+            // Every edge once (lower index first), costed in its cheaper direction
+            candidates.clear();
+            for (uint32_t t = 0; t < triCount; t++) {
+                for (int k = 0; k < 3; k++) {
+                    uint32_t a = tris[t * 3 + k];
+                    uint32_t b = tris[t * 3 + (k + 1) % 3];
+                    if (a > b)
+                        std::swap(a, b);
+                    Quadric q = quadrics[a];
+                    q += quadrics[b];
+                    double costToA = q.Evaluate(positions[a]);
+                    double costToB = q.Evaluate(positions[b]);
+                    if (costToA < costToB)
+                        candidates.push_back({ b, a, costToA });
+                    else
+                        candidates.push_back({ a, b, costToB });
+                }
+            }
+            std::sort(candidates.begin(), candidates.end(), [](const CollapseCandidate& l, const CollapseCandidate& r) {
+                if (l.Cost != r.Cost) return l.Cost < r.Cost;
+                if (l.From != r.From) return l.From < r.From;
+                return l.To < r.To;
+            });
+
+            for (uint32_t v = 0; v < vertexCount; v++)
+                remap[v] = v;
+            std::fill(locked.begin(), locked.end(), (uint8_t)0);
+
+            // An interior edge collapse removes two triangles
+            const uint32_t trianglesToRemove = (uint32_t)(tris.size() - targetIndexCount) / 3;
+            uint32_t removed = 0;
+            uint32_t collapses = 0;
+
+            for (const CollapseCandidate& c : candidates) {
+                if (removed >= trianglesToRemove)
+                    break;
+                if (locked[c.From] || locked[c.To] || c.From == c.To)
+                    continue;
+                if (CollapseFlipsTriangle(c.From, c.To, positions, tris, adjOffsets, adjTris))
+                    continue;
+
+                remap[c.From] = c.To;
+                quadrics[c.To] += quadrics[c.From];
+                maxCost = std::max(maxCost, c.Cost);
+
+                // Lock the whole one-ring so adjacency stays valid for the rest of the pass
+                for (uint32_t k = adjOffsets[c.From]; k < adjOffsets[c.From + 1]; k++) {
+                    const uint32_t* t = &tris[adjTris[k] * 3];
+                    locked[t[0]] = locked[t[1]] = locked[t[2]] = 1;
+                }
+                removed += 2;
+                collapses++;
+            }
+
+            if (collapses == 0)
+                break; // nothing left that can go without flipping the surface
+
+            // Apply the collapses and drop triangles that became degenerate
+            size_t write = 0;
+            for (size_t i = 0; i + 2 < tris.size(); i += 3) {
+                uint32_t a = remap[tris[i]], b = remap[tris[i + 1]], c = remap[tris[i + 2]];
+                if (a == b || b == c || a == c)
+                    continue;
+                tris[write++] = a;
+                tris[write++] = b;
+                tris[write++] = c;
+            }
+            tris.resize(write);
+        }
+
+        if (outError)
+            *outError = (float)std::sqrt(std::max(maxCost, 0.0));
+        return tris;
+    }
+
+    MeshLODChain MeshSimplifier::GenerateLODChain(const Mesh& mesh, const MeshSimplifierSettings& settings) {
+        MeshLODChain chain;
+        chain.Indices = mesh.Indices;
+        chain.Levels.push_back({ 0, (uint32_t)mesh.Indices.size(), 0.0f });
+
+        uint32_t previousCount = (uint32_t)mesh.Indices.size();
+        float previousError = 0.0f;
+
+        for (uint32_t level = 1; level < settings.MaxLevels; level++) {
+            uint32_t target = (uint32_t)(previousCount * settings.ReductionPerLevel) / 3 * 3;
+            if (target / 3 < settings.MinTriangles)
+                break;
+
+            // Always simplify from the original so each level's error is measured against LOD 0
+            float error = 0.0f;
+            std::vector<uint32_t> lod = Simplify(mesh.Positions, mesh.Indices, target, &error);
+
+            // Bail out when the simplifier got stuck well short of the target
+            if (lod.empty() || lod.size() >= previousCount * 95 / 100)
+                break;
+            error = std::max(error, previousError);
+            if (error > settings.MaxError)
+                break;
+
+            chain.Levels.push_back({ (uint32_t)chain.Indices.size(), (uint32_t)lod.size(), error });
+            chain.Indices.insert(chain.Indices.end(), lod.begin(), lod.end());
+            previousCount = (uint32_t)lod.size();
+            previousError = error;
+        }
+
+        return chain;
+    }
+
+}
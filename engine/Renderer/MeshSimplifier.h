@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Mesh.h"
+
+namespace Groove {
+
+    struct MeshSimplifierSettings {
+        uint32_t MaxLevels = 6;          // including LOD 0
+        float    ReductionPerLevel = 0.5f; // target triangle ratio between consecutive levels
+        uint32_t MinTriangles = 4;       // stop once a level would drop below this
+        float    MaxError = 1e30f;       // stop once a level's error exceeds this (object space)
+    };
+
+    // Offline quadric-error-metric simplifier. Edges are collapsed onto one of their
+    // endpoints, so every level re-uses the input vertices and only needs new indices.
+    class MeshSimplifier {
+    public:
+        // Simplifies indices down to roughly targetIndexCount. Returns the new index list
+        // and writes the largest collapse error (object-space distance) to outError.
+        static std::vector<uint32_t> Simplify(const std::vector<glm::vec3>& positions,
+                                              const std::vector<uint32_t>& indices,
+                                              uint32_t targetIndexCount,
+                                              float* outError = nullptr);
+
+        // Builds LOD 0 (the mesh as-is) plus progressively coarser levels
+        static MeshLODChain GenerateLODChain(const Mesh& mesh,
+                                             const MeshSimplifierSettings& settings = MeshSimplifierSettings());
+    };
+
+}
@@ -0,0 +1,546 @@
+#include "ParticleSystem.h"
+#include "Shader.h"
+#include "../Utils/Logger.h"
+#include "../Utils/MemoryTracker.h"
+#include <Camera.h>
+
+#include <glad/glad.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+
+// Shared by every compute pass. Counter layout (std430, bytes):
+//   0 alive count per list, 8 dead count, 12 emit count, 16 emit dispatch args,
+//   32 simulate dispatch args, 48 DrawArraysIndirectCommand
+static const char* particleCommonSrc = R"(
+#version 450 core
+
+struct Particle {
+    vec4 PositionAge;
+    vec4 VelocityLifetime;
+};
+
+layout(std430, binding = 4) buffer ParticleBuffer { Particle u_Particles[]; };
+layout(std430, binding = 5) buffer DeadBuffer     { uint u_Dead[]; };
+layout(std430, binding = 6) buffer AliveBuffer    { uint u_Alive[]; };   // two lists of u_Capacity
+layout(std430, binding = 7) buffer CounterBuffer {
+    uint  u_AliveCount[2];
+    uint  u_DeadCount;
+    uint  u_EmitCount;
+    uvec4 u_EmitDispatch;
+    uvec4 u_SimulateDispatch;
+    uvec4 u_DrawArgs;
+};
+
+uniform uint u_Current;
+uniform uint u_Capacity;
+
+// PCG hash, mirrored by ParticleHash on the CPU
+uint Hash(uint v)
+{
+    uint state = v * 747796405u + 2891336453u;
+    uint word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+    return (word >> 22u) ^ word;
+}
+
+float Random01(inout uint state)
+{
+    state = Hash(state);
+    return float(state >> 8u) / 16777216.0;
+}
+)";
+
+// Single-thread bookkeeping between passes: 0 clamps emission and clears the next alive list,
+// 1 sizes the simulate dispatch, 2 writes the draw arguments
+static const char* particleArgsSrc = R"(
+layout(local_size_x = 1) in;
+
+uniform uint u_Stage;
+uniform uint u_EmitRequest;
+
+void main()
+{
+    uint next = 1u - u_Current;
+    if (u_Stage == 0u) {
+        u_EmitCount = min(u_EmitRequest, u_DeadCount);
+        u_EmitDispatch = uvec4((u_EmitCount + 63u) / 64u, 1u, 1u, 0u);
+        u_AliveCount[next] = 0u;
+    } else if (u_Stage == 1u) {
+        u_SimulateDispatch = uvec4((u_AliveCount[u_Current] + 63u) / 64u, 1u, 1u, 0u);
+    } else {
+        u_DrawArgs = uvec4(6u, u_AliveCount[next], 0u, 0u);
+    }
+}
+)";
+
+static const char* particleEmitSrc = R"(
+layout(local_size_x = 64) in;
+
+uniform uint  u_Seed;
+uniform vec3  u_EmitPosition;
+uniform vec3  u_EmitVelocity;
+uniform float u_VelocitySpread;
+uniform vec2  u_Lifetime;
+
+void main()
+{
+    uint i = gl_GlobalInvocationID.x;
+    if (i >= u_EmitCount)
+        return;
+
+    uint rng = Hash(i + Hash(u_Seed));
+    float rx = Random01(rng);
+    float ry = Random01(rng);
+    float rz = Random01(rng);
+    float rl = Random01(rng);
+
+    Particle p;
+    p.PositionAge = vec4(u_EmitPosition, 0.0);
+    p.VelocityLifetime.xyz = u_EmitVelocity + (vec3(rx, ry, rz) * 2.0 - 1.0) * u_VelocitySpread;
+    p.VelocityLifetime.w = u_Lifetime.x + (u_Lifetime.y - u_Lifetime.x) * rl;
+
+    uint slot = u_Dead[atomicAdd(u_DeadCount, 0xFFFFFFFFu) - 1u];
+    u_Particles[slot] = p;
+    u_Alive[u_Current * u_Capacity + atomicAdd(u_AliveCount[u_Current], 1u)] = slot;
+}
+)";
+
+// Survivors are appended to the other alive list, the rest go back on the dead stack
+static const char* particleSimulateSrc = R"(
+layout(local_size_x = 64) in;
+
+uniform float u_DeltaTime;
+uniform vec3  u_Gravity;
+
+void main()
+{
+    uint i = gl_GlobalInvocationID.x;
+    if (i >= u_AliveCount[u_Current])
+        return;
+
+    uint slot = u_Alive[u_Current * u_Capacity + i];
+    Particle p = u_Particles[slot];
+    p.PositionAge.w += u_DeltaTime;
+    if (p.PositionAge.w >= p.VelocityLifetime.w) {
+        u_Dead[atomicAdd(u_DeadCount, 1u)] = slot;
+        return;
+    }
+
+    p.VelocityLifetime.xyz += u_Gravity * u_DeltaTime;
+    p.PositionAge.xyz += p.VelocityLifetime.xyz * u_DeltaTime;
+    u_Particles[slot] = p;
+
+    uint next = 1u - u_Current;
+    u_Alive[next * u_Capacity + atomicAdd(u_AliveCount[next], 1u)] = slot;
+}
+)";
+
+// Camera-facing quads expanded in view space; one instance per alive particle
+static const char* particleVertexSrc = R"(
+#version 450 core
+
+struct Particle {
+    vec4 PositionAge;
+    vec4 VelocityLifetime;
+};
+
+layout(std430, binding = 4) readonly buffer ParticleBuffer { Particle u_Particles[]; };
+layout(std430, binding = 6) readonly buffer AliveBuffer    { uint u_Alive[]; };
+
+uniform mat4  u_View;
+uniform mat4  u_Proj;
+uniform uint  u_AliveOffset;
+uniform float u_Size;
+uniform vec4  u_ColorStart;
+uniform vec4  u_ColorEnd;
+
+out vec2 v_Corner;
+out vec4 v_Color;
+
+const vec2 c_Corners[6] = vec2[](vec2(-1.0, -1.0), vec2(1.0, -1.0), vec2(1.0, 1.0),
+                                 vec2(1.0, 1.0), vec2(-1.0, 1.0), vec2(-1.0, -1.0));
+
+void main()
+{
+    Particle p = u_Particles[u_Alive[u_AliveOffset + uint(gl_InstanceID)]];
+    v_Corner = c_Corners[gl_VertexID];
+    v_Color = mix(u_ColorStart, u_ColorEnd, clamp(p.PositionAge.w / p.VelocityLifetime.w, 0.0, 1.0));
+
+    vec4 viewPos = u_View * vec4(p.PositionAge.xyz, 1.0);
+    viewPos.xy += v_Corner * u_Size;
+    gl_Position = u_Proj * viewPos;
+}
+)";
+
+static const char* particleFragmentSrc = R"(
+#version 450 core
+
+in vec2 v_Corner;
+in vec4 v_Color;
+
+out vec4 FragColor;
+
+void main()
+{
+    float r2 = dot(v_Corner, v_Corner);
+    if (r2 > 1.0)
+        discard;
+    FragColor = vec4(v_Color.rgb, v_Color.a * (1.0 - r2));
+}
+)";
+
+namespace Groove {
+
+    const uint32_t ParticleSystem::RingSize;
+
+    static const uint32_t CounterWords = 16;
+    static const uint32_t EmitDispatchOffset = 16;
+    static const uint32_t SimulateDispatchOffset = 32;
+    static const uint32_t DrawArgsOffset = 48;
+
+    static uint32_t ParticleHash(uint32_t v) {
+        uint32_t state = v * 747796405u + 2891336453u;
+        uint32_t word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+        return (word >> 22u) ^ word;
+    }
+
+    static float ParticleRandom01(uint32_t& state) {
+        state = ParticleHash(state);
+        return (float)(state >> 8u) / 16777216.0f;
+    }
+
+    // Emission carry shared by both implementations so they request identical counts
+    static uint32_t TakeEmitRequest(float& carry, float deltaTime, const ParticleEmitter& emitter) {
+        carry += std::max(emitter.EmitRate, 0.0f) * deltaTime;
+        uint32_t request = (uint32_t)carry;
+        carry -= (float)request;
+        return request;
+    }
+
+    ParticleSystem::ParticleSystem(uint32_t capacity)
+        : m_Capacity(std::max(capacity, 1u)) {
+        std::string common = particleCommonSrc;
+        m_ArgsShader = new Shader(common + particleArgsSrc);
+        m_EmitShader = new Shader(common + particleEmitSrc);
+        m_SimulateShader = new Shader(common + particleSimulateSrc);
+        m_DrawShader = new Shader(particleVertexSrc, particleFragmentSrc);
+
+        // Every slot starts on the dead stack
+        std::vector<uint32_t> dead(m_Capacity);
+        std::iota(dead.begin(), dead.end(), 0u);
+        uint32_t counters[CounterWords] = {};
+        counters[2] = m_Capacity;
+        counters[DrawArgsOffset / 4] = 6;
+
+        glGenBuffers(1, &m_ParticleSSBO);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_ParticleSSBO);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, (GLsizeiptr)m_Capacity * sizeof(Particle), nullptr, GL_DYNAMIC_COPY);
+
+        glGenBuffers(1, &m_DeadSSBO);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_DeadSSBO);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, (GLsizeiptr)m_Capacity * sizeof(uint32_t), dead.data(), GL_DYNAMIC_COPY);
+
+        glGenBuffers(1, &m_AliveSSBO);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_AliveSSBO);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, (GLsizeiptr)m_Capacity * 2 * sizeof(uint32_t), nullptr, GL_DYNAMIC_COPY);
+
+        glGenBuffers(1, &m_CounterSSBO);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_CounterSSBO);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(counters), counters, GL_DYNAMIC_COPY);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+        for (Slot& slot : m_Slots) {
+            glGenQueries(2, slot.Queries);
+            glGenBuffers(1, &slot.Readback);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, slot.Readback);
+            glBufferData(GL_COPY_WRITE_BUFFER, 4 * sizeof(uint32_t), nullptr, GL_STREAM_READ);
+        }
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+        // The billboards have no vertex attributes, but core profile still needs a VAO bound
+        glGenVertexArrays(1, &m_VAO);
+
+        m_GpuBytes = (int64_t)m_Capacity * (sizeof(Particle) + 3 * sizeof(uint32_t)) + sizeof(counters) +
+                     RingSize * 4 * sizeof(uint32_t);
+        MemoryTracker::TrackGpuAlloc(MemTag::Renderer, m_GpuBytes);
+        m_Stats.Capacity = m_Capacity;
+    }
+
+    ParticleSystem::~ParticleSystem() {
+        glDeleteBuffers(1, &m_ParticleSSBO);
+        glDeleteBuffers(1, &m_DeadSSBO);
+        glDeleteBuffers(1, &m_AliveSSBO);
+        glDeleteBuffers(1, &m_CounterSSBO);
+        for (Slot& slot : m_Slots) {
+            glDeleteQueries(2, slot.Queries);
+            glDeleteBuffers(1, &slot.Readback);
+        }
+        glDeleteVertexArrays(1, &m_VAO);
+        MemoryTracker::TrackGpuFree(MemTag::Renderer, m_GpuBytes);
+
+        delete m_ArgsShader;
+        delete m_EmitShader;
+        delete m_SimulateShader;
+        delete m_DrawShader;
+    }
+
+    void ParticleSystem::Dispatch(Shader& shader, uint32_t indirectOffset) {
+        shader.Bind();
+        shader.SetUniform1ui("u_Current", m_Current);
+        shader.SetUniform1ui("u_Capacity", m_Capacity);
+        glDispatchComputeIndirect((GLintptr)indirectOffset);
+        glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_COMMAND_BARRIER_BIT);
+    }
+
+    void ParticleSystem::Update(float deltaTime, const ParticleEmitter& emitter) {
+        uint32_t emitRequest = TakeEmitRequest(m_EmitCarry, deltaTime, emitter);
+        m_Stats.EmittedLastFrame = emitRequest;
+
+        // Skip timing this frame rather than wait if every slot is still in flight. Timestamps
+        // rather than GL_TIME_ELAPSED, which some software drivers report as zero for compute.
+        Slot& slot = m_Slots[m_Head];
+        bool timed = !slot.Pending;
+        if (timed)
+            glQueryCounter(slot.Queries[0], GL_TIMESTAMP);
+
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, ParticleBinding, m_ParticleSSBO);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, DeadBinding, m_DeadSSBO);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, AliveBinding, m_AliveSSBO);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CounterBinding, m_CounterSSBO);
+        glBindBuffer(GL_DISPATCH_INDIRECT_BUFFER, m_CounterSSBO);
+
+        m_ArgsShader->Bind();
+        m_ArgsShader->SetUniform1ui("u_Current", m_Current);
+        m_ArgsShader->SetUniform1ui("u_Stage", 0);
+        m_ArgsShader->SetUniform1ui("u_EmitRequest", emitRequest);
+        glDispatchCompute(1, 1, 1);
+        glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_COMMAND_BARRIER_BIT);
+
+        m_EmitShader->Bind();
+        m_EmitShader->SetUniform1ui("u_Seed", m_Frame);
+        m_EmitShader->SetUniform3f("u_EmitPosition", emitter.Position);
+        m_EmitShader->SetUniform3f("u_EmitVelocity", emitter.Velocity);
+        m_EmitShader->SetUniform1f("u_VelocitySpread", emitter.VelocitySpread);
+        m_EmitShader->SetUniform2f("u_Lifetime", emitter.LifetimeMin, emitter.LifetimeMax);
+        Dispatch(*m_EmitShader, EmitDispatchOffset);
+
+        m_ArgsShader->Bind();
+        m_ArgsShader->SetUniform1ui("u_Stage", 1);
+        glDispatchCompute(1, 1, 1);
+        glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_COMMAND_BARRIER_BIT);
+
+        m_SimulateShader->Bind();
+        m_SimulateShader->SetUniform1f("u_DeltaTime", deltaTime);
+        m_SimulateShader->SetUniform3f("u_Gravity", emitter.Gravity);
+        Dispatch(*m_SimulateShader, SimulateDispatchOffset);
+
+        m_ArgsShader->Bind();
+        m_ArgsShader->SetUniform1ui("u_Stage", 2);
+        glDispatchCompute(1, 1, 1);
+        // Buffer-update covers the counter copy below and ReadBack's glGetBufferSubData
+        glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_COMMAND_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
+
+        glBindBuffer(GL_DISPATCH_INDIRECT_BUFFER, 0);
+        glUseProgram(0);
+
+        if (timed) {
+            glBindBuffer(GL_COPY_READ_BUFFER, m_CounterSSBO);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, slot.Readback);
+            glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, 4 * sizeof(uint32_t));
+            glBindBuffer(GL_COPY_READ_BUFFER, 0);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+            glQueryCounter(slot.Queries[1], GL_TIMESTAMP);
+            slot.Pending = true;
+            m_Head = (m_Head + 1) % RingSize;
+        }
+
+        m_Current = 1 - m_Current;
+        m_Frame++;
+        PollTimings();
+    }
+
+    void ParticleSystem::PollTimings() {
+        // Oldest in-flight slot first; stop at the first one the GPU has not finished
+        for (uint32_t i = 0; i < RingSize; i++) {
+            Slot& slot = m_Slots[(m_Head + i) % RingSize];
+            if (!slot.Pending)
+                continue;
+            GLint available = 0;
+            glGetQueryObjectiv(slot.Queries[1], GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available)
+                break;
+
+            GLuint64 begin = 0, end = 0;
+            glGetQueryObjectui64v(slot.Queries[0], GL_QUERY_RESULT, &begin);
+            glGetQueryObjectui64v(slot.Queries[1], GL_QUERY_RESULT, &end);
+            uint32_t counters[4] = {};
+            glBindBuffer(GL_COPY_READ_BUFFER, slot.Readback);
+            glGetBufferSubData(GL_COPY_READ_BUFFER, 0, sizeof(counters), counters);
+            glBindBuffer(GL_COPY_READ_BUFFER, 0);
+            slot.Pending = false;
+
+            // Every slot is either on the dead stack or in the freshly written alive list
+            m_Stats.AliveCount = m_Capacity - std::min(counters[2], m_Capacity);
+            m_Stats.SimulateMs = (float)((double)(end - begin) / 1.0e6);
+            m_Stats.ParticlesPerMs = m_Stats.SimulateMs > 0.0f ? (float)m_Stats.AliveCount / m_Stats.SimulateMs : 0.0f;
+        }
+    }
+
+    void ParticleSystem::Draw(const Camera& cam, const ParticleEmitter& emitter) {
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, ParticleBinding, m_ParticleSSBO);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, AliveBinding, m_AliveSSBO);
+
+        m_DrawShader->Bind();
+        m_DrawShader->SetUniformMat4f("u_View", cam.GetViewMatrix());
+        m_DrawShader->SetUniformMat4f("u_Proj", cam.GetProjectionMatrix());
+        m_DrawShader->SetUniform1ui("u_AliveOffset", m_Current * m_Capacity);
+        m_DrawShader->SetUniform1f("u_Size", emitter.Size);
+        m_DrawShader->SetUniform4f("u_ColorStart", emitter.ColorStart);
+        m_DrawShader->SetUniform4f("u_ColorEnd", emitter.ColorEnd);
+
+        // Additive, depth-tested against the scene but not writing depth, so order does not matter
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE);
+        glDepthMask(GL_FALSE);
+
+        glBindVertexArray(m_VAO);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_CounterSSBO);
+        glDrawArraysIndirect(GL_TRIANGLES, (const void*)(uintptr_t)DrawArgsOffset);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+
+        glDepthMask(GL_TRUE);
+        glDisable(GL_BLEND);
+    }
+
+    void ParticleSystem::ReadBack(std::vector<Particle>& outAlive) {
+        uint32_t counters[2] = {};
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_CounterSSBO);
+        glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(counters), counters);
+        uint32_t aliveCount = std::min(counters[m_Current], m_Capacity);
+
+        std::vector<uint32_t> alive(aliveCount);
+        std::vector<Particle> particles(m_Capacity);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_AliveSSBO);
+        glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, (GLintptr)m_Current * m_Capacity * sizeof(uint32_t),
+                           (GLsizeiptr)aliveCount * sizeof(uint32_t), alive.data());
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_ParticleSSBO);
+        glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, (GLsizeiptr)m_Capacity * sizeof(Particle), particles.data());
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+        outAlive.resize(aliveCount);
+        for (uint32_t i = 0; i < aliveCount; i++)
+            outAlive[i] = particles[alive[i] < m_Capacity ? alive[i] : 0];
+    }
+
+    // Particles are matched by aggregate: slot assignment differs between the two (GPU atomics are
+    // unordered) but each particle's state depends only on its frame and emission index.
+    ParticleValidation ParticleSystem::Validate(uint32_t capacity, uint32_t frames, float deltaTime,
+                                                const ParticleEmitter& emitter) {
+        ParticleValidation result;
+        ParticleSystem gpu(capacity);
+        ParticleSystemCPU cpu(capacity);
+        for (uint32_t frame = 0; frame < frames; frame++) {
+            gpu.Update(deltaTime, emitter);
+            cpu.Update(deltaTime, emitter);
+        }
+
+        std::vector<Particle> gpuAlive;
+        gpu.ReadBack(gpuAlive);
+        result.GpuAlive = (uint32_t)gpuAlive.size();
+        result.CpuAlive = cpu.GetAliveCount();
+
+        double gpuSum[3] = {}, cpuSum[3] = {};
+        for (const Particle& p : gpuAlive) {
+            for (int axis = 0; axis < 3; axis++)
+                gpuSum[axis] += p.PositionAge[axis];
+        }
+        for (uint32_t i = 0; i < result.CpuAlive; i++) {
+            const Particle& p = cpu.GetParticles()[cpu.GetAliveList()[i]];
+            for (int axis = 0; axis < 3; axis++)
+                cpuSum[axis] += p.PositionAge[axis];
+        }
+        if (result.GpuAlive > 0 && result.CpuAlive > 0) {
+            double errorSq = 0.0;
+            for (int axis = 0; axis < 3; axis++) {
+                double d = gpuSum[axis] / result.GpuAlive - cpuSum[axis] / result.CpuAlive;
+                errorSq += d * d;
+            }
+            result.CentroidError = (float)std::sqrt(errorSq);
+        }
+
+        // The GPU may fuse multiply-adds, so a particle right at its lifetime can die a frame apart
+        uint32_t countDiff = result.GpuAlive > result.CpuAlive ? result.GpuAlive - result.CpuAlive
+                                                               : result.CpuAlive - result.GpuAlive;
+        result.Passed = countDiff <= std::max(result.CpuAlive / 10000u, 1u) && result.CentroidError < 1.0e-3f;
+        Logger::Info(std::string("Particle validation: ") + (result.Passed ? "passed" : "FAILED") +
+                     " | GPU alive " + std::to_string(result.GpuAlive) + " | CPU alive " + std::to_string(result.CpuAlive) +
+                     " | centroid error " + std::to_string(result.CentroidError));
+        return result;
+    }
+
+    ParticleSystemCPU::ParticleSystemCPU(uint32_t capacity)
+        : m_Capacity(std::max(capacity, 1u)), m_DeadCount(m_Capacity) {
+        m_Particles.resize(m_Capacity);
+        m_Dead.resize(m_Capacity);
+        std::iota(m_Dead.begin(), m_Dead.end(), 0u);
+        m_Alive[0].resize(m_Capacity);
+        m_Alive[1].resize(m_Capacity);
+        m_Stats.Capacity = m_Capacity;
+    }
+
+    void ParticleSystemCPU::Update(float deltaTime, const ParticleEmitter& emitter) {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        uint32_t emitRequest = TakeEmitRequest(m_EmitCarry, deltaTime, emitter);
+        uint32_t emitCount = std::min(emitRequest, m_DeadCount);
+        uint32_t seedHash = ParticleHash(m_Frame);
+        std::vector<uint32_t>& current = m_Alive[m_Current];
+        for (uint32_t i = 0; i < emitCount; i++) {
+            uint32_t rng = ParticleHash(i + seedHash);
+            float rx = ParticleRandom01(rng);
+            float ry = ParticleRandom01(rng);
+            float rz = ParticleRandom01(rng);
+            float rl = ParticleRandom01(rng);
+
+            Particle& p = m_Particles[m_Dead[--m_DeadCount]];
+            p.PositionAge = glm::vec4(emitter.Position, 0.0f);
+            p.VelocityLifetime = glm::vec4(emitter.Velocity + (glm::vec3(rx, ry, rz) * 2.0f - 1.0f) * emitter.VelocitySpread,
+                                           emitter.LifetimeMin + (emitter.LifetimeMax - emitter.LifetimeMin) * rl);
+            current[m_AliveCount++] = m_Dead[m_DeadCount];
+        }
+
+        // Same compaction as the simulate pass, in order
+        std::vector<uint32_t>& next = m_Alive[1 - m_Current];
+        uint32_t nextCount = 0;
+        glm::vec3 gravityStep = emitter.Gravity * deltaTime;
+        for (uint32_t i = 0; i < m_AliveCount; i++) {
+            uint32_t slot = current[i];
+            Particle& p = m_Particles[slot];
+            p.PositionAge.w += deltaTime;
+            if (p.PositionAge.w >= p.VelocityLifetime.w) {
+                m_Dead[m_DeadCount++] = slot;
+                continue;
+            }
+            p.VelocityLifetime.x += gravityStep.x;
+            p.VelocityLifetime.y += gravityStep.y;
+            p.VelocityLifetime.z += gravityStep.z;
+            p.PositionAge.x += p.VelocityLifetime.x * deltaTime;
+            p.PositionAge.y += p.VelocityLifetime.y * deltaTime;
+            p.PositionAge.z += p.VelocityLifetime.z * deltaTime;
+            next[nextCount++] = slot;
+        }
+
+        m_Current = 1 - m_Current;
+        m_AliveCount = nextCount;
+        m_Frame++;
+
+        m_Stats.AliveCount = m_AliveCount;
+        m_Stats.EmittedLastFrame = emitRequest;
+        m_Stats.SimulateMs = std::chrono::duration<float, std::milli>(
+            std::chrono::high_resolution_clock::now() - start).count();
+        m_Stats.ParticlesPerMs = m_Stats.SimulateMs > 0.0f ? (float)m_AliveCount / m_Stats.SimulateMs : 0.0f;
+    }
+
+}
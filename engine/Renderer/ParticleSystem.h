@@ -0,0 +1,137 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace Groove {
+
+    class Camera;
+    class Shader;
+
+    // std430 layout, matches Particle in the compute and billboard shaders
+    struct Particle {
+        glm::vec4 PositionAge;        // xyz world position, w seconds alive
+        glm::vec4 VelocityLifetime;   // xyz velocity, w total lifetime in seconds
+    };
+
+    struct ParticleEmitter {
+        glm::vec3 Position{ 0.0f, 1.0f, 0.0f };
+        glm::vec3 Velocity{ 0.0f, 6.0f, 0.0f };
+        float     VelocitySpread = 3.0f;              // +- per axis, uniform
+        glm::vec3 Gravity{ 0.0f, -9.81f, 0.0f };
+        float     LifetimeMin = 1.0f;
+        float     LifetimeMax = 2.5f;
+        float     EmitRate = 100000.0f;               // particles per second
+        float     Size = 0.04f;                       // billboard half-size in world units
+        glm::vec4 ColorStart{ 1.0f, 0.7f, 0.2f, 1.0f };
+        glm::vec4 ColorEnd{ 0.9f, 0.1f, 0.05f, 0.0f };
+    };
+
+    struct ParticleStats {
+        uint32_t Capacity = 0;
+        uint32_t AliveCount = 0;        // GPU: from the latest readback, a frame or two old
+        uint32_t EmittedLastFrame = 0;  // requested; the GPU clamps to the dead list
+        float    SimulateMs = 0.0f;     // GPU: emission + simulation + compaction, CPU: Update
+        float    ParticlesPerMs = 0.0f;
+    };
+
+    struct ParticleValidation {
+        uint32_t GpuAlive = 0;
+        uint32_t CpuAlive = 0;
+        float    CentroidError = 0.0f;   // distance between the mean alive positions
+        bool     Passed = false;
+    };
+
+    // GPU particles: emission, simulation and dead-list compaction run as compute passes over
+    // SSBOs; the last pass writes the indirect draw arguments, so the CPU never reads counts back
+    // before drawing. Particles live in a fixed pool; a dead-index stack hands out slots and the
+    // alive list is rebuilt compactly each frame into the other half of a ping-pong buffer.
+    class ParticleSystem {
+    public:
+        // SSBO binding points, kept clear of ClusteredLighting's 0-2
+        static const uint32_t ParticleBinding = 4;
+        static const uint32_t DeadBinding = 5;
+        static const uint32_t AliveBinding = 6;
+        static const uint32_t CounterBinding = 7;
+        static const uint32_t RingSize = 3;
+
+        explicit ParticleSystem(uint32_t capacity);
+        ~ParticleSystem();
+
+        ParticleSystem(const ParticleSystem&) = delete;
+        ParticleSystem& operator=(const ParticleSystem&) = delete;
+
+        // Emits EmitRate * dt particles (fraction carried over) and advances everything by dt
+        void Update(float deltaTime, const ParticleEmitter& emitter);
+        // Instanced billboards using the GPU-written indirect arguments (additive, no depth write)
+        void Draw(const Camera& cam, const ParticleEmitter& emitter);
+
+        // Waits for the GPU and copies out every alive particle (validation only)
+        void ReadBack(std::vector<Particle>& outAlive);
+
+        const ParticleStats& GetStats() const { return m_Stats; }
+
+        // Runs a GPU and a CPU system side by side for a fixed number of frames and compares them
+        static ParticleValidation Validate(uint32_t capacity, uint32_t frames, float deltaTime,
+                                           const ParticleEmitter& emitter);
+
+    private:
+        void Dispatch(Shader& shader, uint32_t indirectOffset);
+        void PollTimings();
+
+        uint32_t m_Capacity;
+        uint32_t m_Current = 0;         // alive list the next Update reads
+        uint32_t m_Frame = 0;
+        float m_EmitCarry = 0.0f;
+
+        uint32_t m_ParticleSSBO = 0, m_DeadSSBO = 0, m_AliveSSBO = 0, m_CounterSSBO = 0;
+        uint32_t m_VAO = 0;
+        int64_t m_GpuBytes = 0;
+
+        Shader* m_ArgsShader = nullptr;
+        Shader* m_EmitShader = nullptr;
+        Shader* m_SimulateShader = nullptr;
+        Shader* m_DrawShader = nullptr;
+
+        // Timestamp pair + counter readback per frame in flight, read once available
+        struct Slot {
+            uint32_t Queries[2] = {};
+            uint32_t Readback = 0;
+            bool     Pending = false;
+        };
+        Slot m_Slots[RingSize];
+        uint32_t m_Head = 0;
+
+        ParticleStats m_Stats;
+    };
+
+    // Reference implementation of the same pipeline (same random stream, same integration),
+    // for checking the GPU path on software rasterizers and for CPU throughput comparison.
+    class ParticleSystemCPU {
+    public:
+        explicit ParticleSystemCPU(uint32_t capacity);
+
+        void Update(float deltaTime, const ParticleEmitter& emitter);
+
+        uint32_t GetAliveCount() const { return m_AliveCount; }
+        const Particle* GetParticles() const { return m_Particles.data(); }
+        const uint32_t* GetAliveList() const { return m_Alive[m_Current].data(); }
+        const ParticleStats& GetStats() const { return m_Stats; }
+
+    private:
+        uint32_t m_Capacity;
+        uint32_t m_Current = 0;
+        uint32_t m_Frame = 0;
+        float m_EmitCarry = 0.0f;
+
+        std::vector<Particle> m_Particles;
+        std::vector<uint32_t> m_Dead;
+        std::vector<uint32_t> m_Alive[2];
+        uint32_t m_DeadCount;
+        uint32_t m_AliveCount = 0;
+
+        ParticleStats m_Stats;
+    };
+
+}
@@ -1,7 +1,16 @@
 #include "Renderer.h"
 #include "../src/Transform.hpp"
 #include "Shader.h"
+#include "Mesh.h"
+#include "MeshSimplifier.h"
+#include "ClusteredLighting.h"
+#include "StaticBatch.h"
+#include "ParticleSystem.h"
+#include "CascadedShadowMap.h"
+#include "../Utils/BatchMath.h"
 #include "../Utils/Logger.h"
+#include "../Utils/Memory.h"
+#include "../Utils/MemoryTracker.h"
 #include <glad/glad.h>
 //#include <Transform.h>
 #include <Camera.h>
@@ -31,71 +40,471 @@ uniform mat4 u_Model;
 uniform mat4 u_View;
 uniform mat4 u_Proj;
 
+out vec3 v_WorldPos;
+out vec3 v_ViewPos;
+
 void main()
 {
+    vec4 worldPos = u_Model * vec4(aPos, 1.0);
+    vec4 viewPos = u_View * worldPos;
+    v_WorldPos = worldPos.xyz;
+    v_ViewPos = viewPos.xyz;
+
     // Transform into clip space
-    gl_Position = u_Proj * u_View * u_Model * vec4(aPos, 1.0);
+    gl_Position = u_Proj * viewPos;
 }
 )";
 
+// Clustered forward lighting: each fragment only loops over the lights assigned to its
+// cluster by ClusteredLighting. u_NaiveLighting loops over every light instead (for comparison).
 static const char* fragmentSrc = R"(
 #version 450 core
 
+struct PointLight {
+    vec4 PositionRadius;
+    vec4 ColorIntensity;
+};
+
+layout(std430, binding = 0) readonly buffer LightBuffer   { PointLight u_Lights[]; };
+layout(std430, binding = 1) readonly buffer ClusterBuffer { uvec2 u_ClusterRanges[]; };
+layout(std430, binding = 2) readonly buffer IndexBuffer   { uint u_LightIndices[]; };
+
+in vec3 v_WorldPos;
+in vec3 v_ViewPos;
+
+uniform ivec3 u_ClusterDims;
+uniform vec2  u_ViewportSize;
+uniform vec2  u_DepthRange;     // near, far
+uniform int   u_LightCount;
+uniform int   u_NaiveLighting;
+uniform vec3  u_Albedo;
+
+uniform vec3  u_SunDirection;   // direction the light travels
+uniform vec3  u_SunColor;       // color * intensity
+uniform int   u_ShadowsEnabled;
+uniform mat4  u_CascadeViewProj[4];
+uniform vec4  u_CascadeSplits;  // view depth where each cascade ends
+uniform vec4  u_CascadeTexel;   // world size of one shadow texel per cascade
+uniform sampler2DArrayShadow u_ShadowMap;
+
 out vec4 FragColor;
 
+const vec3 c_Ambient = vec3(0.08);
+
+// 3x3 PCF over hardware-filtered comparisons in the first cascade that covers this depth
+float SunShadow(vec3 pos, vec3 n, float depth)
+{
+    if (u_ShadowsEnabled == 0 || depth > u_CascadeSplits[3])
+        return 1.0;
+    int cascade = 0;
+    while (cascade < 3 && depth > u_CascadeSplits[cascade])
+        cascade++;
+
+    // Offset along the normal by a texel and a half against self-shadowing on lit faces
+    vec4 lightPos = u_CascadeViewProj[cascade] * vec4(pos + n * u_CascadeTexel[cascade] * 1.5, 1.0);
+    vec3 uvz = lightPos.xyz * 0.5 + 0.5;
+    vec2 texel = 1.0 / vec2(textureSize(u_ShadowMap, 0).xy);
+    float lit = 0.0;
+    for (int y = -1; y <= 1; y++)
+        for (int x = -1; x <= 1; x++)
+            lit += texture(u_ShadowMap, vec4(uvz.xy + vec2(x, y) * texel, float(cascade), uvz.z));
+    return lit / 9.0;
+}
+
+vec3 EvaluateLight(PointLight light, vec3 pos, vec3 n)
+{
+    vec3 toLight = light.PositionRadius.xyz - pos;
+    float dist = length(toLight);
+    float radius = light.PositionRadius.w;
+    if (dist >= radius)
+        return vec3(0.0);
+    float falloff = 1.0 - dist / radius;
+    float ndotl = max(dot(n, toLight / max(dist, 1e-4)), 0.0);
+    return light.ColorIntensity.rgb * light.ColorIntensity.a * ndotl * falloff * falloff;
+}
+
+void main()
+{
+    // Flat face normal from screen-space derivatives (the cube has no normal attribute)
+    vec3 n = normalize(cross(dFdx(v_WorldPos), dFdy(v_WorldPos)));
+    vec3 lighting = c_Ambient;
+    lighting += u_SunColor * max(dot(n, -u_SunDirection), 0.0) * SunShadow(v_WorldPos, n, -v_ViewPos.z);
+
+    if (u_NaiveLighting != 0) {
+        for (int i = 0; i < u_LightCount; i++)
+            lighting += EvaluateLight(u_Lights[i], v_WorldPos, n);
+    } else {
+        uvec2 tile = uvec2(gl_FragCoord.xy / u_ViewportSize * vec2(u_ClusterDims.xy));
+        tile = min(tile, uvec2(u_ClusterDims.xy) - 1u);
+        float depth = max(-v_ViewPos.z, u_DepthRange.x);
+        int slice = int(floor(log(depth / u_DepthRange.x) / log(u_DepthRange.y / u_DepthRange.x) * float(u_ClusterDims.z)));
+        slice = clamp(slice, 0, u_ClusterDims.z - 1);
+
+        uint cluster = tile.x + tile.y * uint(u_ClusterDims.x) + uint(slice) * uint(u_ClusterDims.x * u_ClusterDims.y);
+        uvec2 range = u_ClusterRanges[cluster];
+        for (uint i = 0u; i < range.y; i++)
+            lighting += EvaluateLight(u_Lights[u_LightIndices[range.x + i]], v_WorldPos, n);
+    }
+
+    FragColor = vec4(u_Albedo * lighting, 1.0);
+}
+)";
+
+// Entity-ID pass for GPUPicker, writes id + 1 (0 = background). Two submit shapes, both one
+// draw for any object count: instanced unit cubes with their model matrices in an SSBO, or a
+// StaticBatch in world space with its per-vertex object index.
+static const char* pickVertexSrc = R"(
+#version 450 core
+
+layout(location = 0) in vec3 aPos;
+layout(location = 1) in uint aObjectID;
+
+layout(std430, binding = 3) readonly buffer PickModelBuffer { mat4 u_PickModels[]; };
+
+uniform mat4 u_View;
+uniform mat4 u_Proj;
+uniform int  u_Instanced;
+uniform uint u_IDBase;
+
+flat out uint v_EntityID;
+
+void main()
+{
+    mat4 model = mat4(1.0);
+    uint id = aObjectID;
+    if (u_Instanced != 0) {
+        model = u_PickModels[gl_InstanceID];
+        id = uint(gl_InstanceID);
+    }
+    v_EntityID = u_IDBase + id;
+    gl_Position = u_Proj * u_View * model * vec4(aPos, 1.0);
+}
+)";
+
+static const char* pickFragmentSrc = R"(
+#version 450 core
+
+flat in uint v_EntityID;
+
+layout(location = 0) out uint o_EntityID;
+
+void main()
+{
+    o_EntityID = v_EntityID + 1u;
+}
+)";
+
+// Shadow depth pass: world -> light clip space, depth only
+static const char* shadowVertexSrc = R"(
+#version 450 core
+
+layout(location = 0) in vec3 aPos;
+
+uniform mat4 u_Model;
+uniform mat4 u_LightViewProj;
+
+void main()
+{
+    gl_Position = u_LightViewProj * u_Model * vec4(aPos, 1.0);
+}
+)";
+
+static const char* shadowFragmentSrc = R"(
+#version 450 core
+
 void main()
 {
-    // Simple solid color
-    FragColor = vec4(0.9, 0.3, 0.4, 1.0);
 }
 )";
 
 
 namespace Groove {
 
+    // One queued DrawCube. Packets come from a pool and go back to it when flushed, so per-object
+    // draws never touch the heap; flushing every DrawPacketBatch packets keeps the pool one chunk.
+    struct DrawPacket {
+        glm::mat4   Model;
+        uint32_t    IndexCount;
+        uint32_t    IndexOffset;
+        DrawPacket* Next;
+    };
+    static const uint32_t DrawPacketBatch = 4096;
+    static ObjectPool<DrawPacket, DrawPacketBatch>* s_DrawPackets = nullptr;
+    static DrawPacket* s_DrawQueueHead = nullptr;
+    static DrawPacket* s_DrawQueueTail = nullptr;
+    static uint32_t s_DrawQueueCount = 0;
+    static const Camera* s_DrawQueueCamera = nullptr;
+
     unsigned int Renderer::s_VAO = 0;
     unsigned int Renderer::s_VBO = 0;
     unsigned int Renderer::s_IBO = 0; // Define the missing static member
     Shader* Renderer::s_Shader = nullptr;
+    Shader* Renderer::s_PickShader = nullptr;
+    unsigned int Renderer::s_PickModelSSBO = 0;
+    uint32_t Renderer::s_PickModelCapacity = 0;
+    Mesh* Renderer::s_CubeMesh = nullptr;
+    MeshLODChain* Renderer::s_CubeLODs = nullptr;
+    ClusteredLighting* Renderer::s_Lighting = nullptr;
+    bool Renderer::s_NaiveLighting = false;
+    CascadedShadowMap* Renderer::s_Shadows = nullptr;
+    Shader* Renderer::s_ShadowShader = nullptr;
+    DirectionalLight* Renderer::s_Sun = nullptr;
+    bool Renderer::s_ShadowsRendered = false;
 
 
     void Renderer::Init() {
+        MemoryTagScope memTag(MemTag::Renderer);
         Logger::Info("Renderer initializing...");
         glEnable(GL_DEPTH_TEST);
 
 
+        // Build the LOD chain offline-style: every level is an index range after LOD 0
+        s_CubeMesh = new Mesh();
+        for (size_t i = 0; i < sizeof(cubeVerts) / sizeof(float); i += 3)
+            s_CubeMesh->Positions.push_back(glm::vec3(cubeVerts[i], cubeVerts[i + 1], cubeVerts[i + 2]));
+        s_CubeMesh->Indices.assign(cubeIndices, cubeIndices + sizeof(cubeIndices) / sizeof(unsigned int));
+        s_CubeLODs = new MeshLODChain(MeshSimplifier::GenerateLODChain(*s_CubeMesh));
+        Logger::Info("Cube LOD chain: " + std::to_string(s_CubeLODs->GetLevelCount()) + " levels.");
+
         // Create and bind VAO
-        // In Init(): generated VAO/VBO/IBO instead of just VBO
-        unsigned int IBO;
         glGenVertexArrays(1, &s_VAO);
         glBindVertexArray(s_VAO);
 
         glGenBuffers(1, &s_VBO);
         glBindBuffer(GL_ARRAY_BUFFER, s_VBO);
         glBufferData(GL_ARRAY_BUFFER, sizeof(cubeVerts), cubeVerts, GL_STATIC_DRAW);
+        MemoryTracker::TrackGpuAlloc(MemTag::Renderer, sizeof(cubeVerts));
 
-        glGenBuffers(1, &IBO);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, IBO);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(cubeIndices), cubeIndices, GL_STATIC_DRAW);
+        glGenBuffers(1, &s_IBO);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, s_IBO);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, s_CubeLODs->Indices.size() * sizeof(uint32_t),
+                     s_CubeLODs->Indices.data(), GL_STATIC_DRAW);
+        MemoryTracker::TrackGpuAlloc(MemTag::Renderer, s_CubeLODs->Indices.size() * sizeof(uint32_t));
 
         glEnableVertexAttribArray(0);
         glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
 
         // Create shader
         s_Shader = new Shader(vertexSrc, fragmentSrc);
+        s_PickShader = new Shader(pickVertexSrc, pickFragmentSrc);
         s_Shader->Bind();
 
+        s_Lighting = new ClusteredLighting();
+        s_DrawPackets = new ObjectPool<DrawPacket, DrawPacketBatch>();
+        s_DrawPackets->Reserve(DrawPacketBatch);
+
+        s_ShadowShader = new Shader(shadowVertexSrc, shadowFragmentSrc);
+        s_Shadows = new CascadedShadowMap();
+        s_Sun = new DirectionalLight();
+
         Logger::Info("Renderer initialized.");
     }
 
-    void Renderer::DrawCube(const Transform& t, const Camera& cam) {
+    void Renderer::BeginScene(const Camera& cam, int viewportWidth, int viewportHeight) {
+        MemoryTagScope memTag(MemTag::Renderer);
+        s_Lighting->Update(cam);
+        s_Lighting->Bind();
+
         s_Shader->Bind();
-        // set uniforms
-        s_Shader->SetUniformMat4f("u_Model", t.GetMatrix());
+        s_Shader->SetUniform3i("u_ClusterDims", ClusteredLighting::ClusterX, ClusteredLighting::ClusterY, ClusteredLighting::ClusterZ);
+        s_Shader->SetUniform2f("u_ViewportSize", (float)viewportWidth, (float)viewportHeight);
+        s_Shader->SetUniform2f("u_DepthRange", cam.GetNearClip(), cam.GetFarClip());
+        s_Shader->SetUniform1i("u_LightCount", (int)s_Lighting->GetLightCount());
+        s_Shader->SetUniform1i("u_NaiveLighting", s_NaiveLighting ? 1 : 0);
+
+        s_Shader->SetUniform3f("u_SunDirection", glm::normalize(s_Sun->Direction));
+        s_Shader->SetUniform3f("u_SunColor", s_Sun->Color * s_Sun->Intensity);
+        s_Shader->SetUniform1i("u_ShadowsEnabled", s_ShadowsRendered ? 1 : 0);
+        if (s_ShadowsRendered)
+            s_Shadows->Bind(*s_Shader);
+        s_ShadowsRendered = false;
+
+        s_Lighting->BeginShadingTimer();
+    }
+
+    void Renderer::EndScene() {
+        FlushDraws();
+        s_Lighting->EndShadingTimer();
+    }
+
+    void Renderer::SetLights(const PointLight* lights, uint32_t count) {
+        s_Lighting->SetLights(lights, count);
+    }
+
+    void Renderer::SetNaiveLighting(bool naive) {
+        s_NaiveLighting = naive;
+    }
+
+    const ClusterStats& Renderer::GetLightingStats() {
+        return s_Lighting->GetStats();
+    }
+
+    void Renderer::SetDirectionalLight(const DirectionalLight& light) {
+        *s_Sun = light;
+    }
+
+    void Renderer::RenderShadows(const Camera& cam, const Transform* dynamicObjects, uint32_t dynamicCount,
+                                 StaticBatch* staticBatch) {
+        MemoryTagScope memTag(MemTag::Renderer);
+        s_Shadows->Prepare(cam, *s_Sun, dynamicObjects, dynamicCount, staticBatch);
+
+        const MeshLOD& level = s_CubeLODs->Levels[0];
+        uint32_t drawCalls = 0;
+        s_Shadows->BeginRender();
+        s_ShadowShader->Bind();
+        for (uint32_t c = 0; c < CascadedShadowMap::CascadeCount; c++) {
+            if (!s_Shadows->NeedsRender(c))
+                continue;
+            s_Shadows->BeginCascade(c);
+            s_ShadowShader->SetUniformMat4f("u_LightViewProj", s_Shadows->GetViewProj(c));
+
+            if (s_Shadows->DrawsDynamic(c)) {
+                const uint8_t* casters = s_Shadows->GetDynamicMask(c);
+                const glm::mat4* models = s_Shadows->GetDynamicMatrices();
+                glBindVertexArray(s_VAO);
+                for (uint32_t i = 0; i < dynamicCount; i++) {
+                    if (!casters[i])
+                        continue;
+                    s_ShadowShader->SetUniformMat4f("u_Model", models[i]);
+                    glDrawElements(GL_TRIANGLES, level.IndexCount, GL_UNSIGNED_INT,
+                                   (void*)(uintptr_t)(level.IndexOffset * sizeof(uint32_t)));
+                    drawCalls++;
+                }
+            }
+            if (staticBatch && staticBatch->IsBuilt()) {
+                s_ShadowShader->SetUniformMat4f("u_Model", glm::mat4(1.0f));
+                staticBatch->Draw(*s_ShadowShader, s_Shadows->GetStaticMask(c), false);
+                drawCalls += staticBatch->GetStats().DrawCalls;
+            }
+        }
+        s_Shadows->EndRender(drawCalls);
+        glBindVertexArray(s_VAO);
+        s_ShadowsRendered = true;
+    }
+
+    void Renderer::SetShadowCaching(bool enabled) {
+        s_Shadows->SetCaching(enabled);
+    }
+
+    const ShadowStats& Renderer::GetShadowStats() {
+        return s_Shadows->GetStats();
+    }
+
+    void Renderer::DrawCube(const Transform& t, const Camera& cam, uint32_t lod) {
+        if (s_DrawQueueCamera && s_DrawQueueCamera != &cam)
+            FlushDraws();
+        s_DrawQueueCamera = &cam;
+
+        const MeshLOD& level = s_CubeLODs->Levels[lod < s_CubeLODs->GetLevelCount() ? lod : s_CubeLODs->GetLevelCount() - 1];
+        DrawPacket* packet = s_DrawPackets->New();
+        packet->Model = t.GetMatrix();
+        packet->IndexCount = level.IndexCount;
+        packet->IndexOffset = level.IndexOffset;
+        packet->Next = nullptr;
+        if (s_DrawQueueTail)
+            s_DrawQueueTail->Next = packet;
+        else
+            s_DrawQueueHead = packet;
+        s_DrawQueueTail = packet;
+
+        if (++s_DrawQueueCount == DrawPacketBatch)
+            FlushDraws();
+    }
+
+    void Renderer::FlushDraws() {
+        if (!s_DrawQueueHead)
+            return;
+
+        // Shared state once per flush; only the model matrix changes per packet
+        s_Shader->Bind();
+        s_Shader->SetUniformMat4f("u_View", s_DrawQueueCamera->GetViewMatrix());
+        s_Shader->SetUniformMat4f("u_Proj", s_DrawQueueCamera->GetProjectionMatrix());
+        s_Shader->SetUniform3f("u_Albedo", glm::vec3(0.9f, 0.3f, 0.4f));
+        const int modelLocation = s_Shader->GetUniformLocation("u_Model");
+        glBindVertexArray(s_VAO);
+
+        DrawPacket* packet = s_DrawQueueHead;
+        while (packet) {
+            glUniformMatrix4fv(modelLocation, 1, GL_FALSE, &packet->Model[0][0]);
+            glDrawElements(GL_TRIANGLES, packet->IndexCount, GL_UNSIGNED_INT,
+                           (void*)(uintptr_t)(packet->IndexOffset * sizeof(uint32_t)));
+            DrawPacket* next = packet->Next;
+            s_DrawPackets->Delete(packet);
+            packet = next;
+        }
+        s_DrawQueueHead = s_DrawQueueTail = nullptr;
+        s_DrawQueueCount = 0;
+        s_DrawQueueCamera = nullptr;
+    }
+
+    void Renderer::DrawCubesID(const Transform* transforms, uint32_t count, const Camera& cam, uint32_t idBase) {
+        if (count == 0)
+            return;
+        MemoryTagScope memTag(MemTag::Renderer);
+        glm::mat4* models = static_cast<glm::mat4*>(
+            Memory::GetFrameArena().Allocate(count * sizeof(glm::mat4), alignof(glm::mat4)));
+        BatchMath::ComposeTransforms(transforms, count, models, nullptr, nullptr);
+
+        if (!s_PickModelSSBO)
+            glGenBuffers(1, &s_PickModelSSBO);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, s_PickModelSSBO);
+        if (count > s_PickModelCapacity) {
+            MemoryTracker::TrackGpuFree(MemTag::Renderer, (int64_t)s_PickModelCapacity * sizeof(glm::mat4));
+            s_PickModelCapacity = count;
+            glBufferData(GL_SHADER_STORAGE_BUFFER, count * sizeof(glm::mat4), models, GL_DYNAMIC_DRAW);
+            MemoryTracker::TrackGpuAlloc(MemTag::Renderer, (int64_t)count * sizeof(glm::mat4));
+        } else {
+            glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, count * sizeof(glm::mat4), models);
+        }
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, PickModelBinding, s_PickModelSSBO);
+
+        s_PickShader->Bind();
+        s_PickShader->SetUniformMat4f("u_View", cam.GetViewMatrix());
+        s_PickShader->SetUniformMat4f("u_Proj", cam.GetProjectionMatrix());
+        s_PickShader->SetUniform1i("u_Instanced", 1);
+        s_PickShader->SetUniform1ui("u_IDBase", idBase);
+        // LOD 0 for every instance: one draw can't mix index ranges, and picks want the exact shape
+        glBindVertexArray(s_VAO);
+        const MeshLOD& level = s_CubeLODs->Levels[0];
+        glDrawElementsInstanced(GL_TRIANGLES, level.IndexCount, GL_UNSIGNED_INT,
+                                (void*)(uintptr_t)(level.IndexOffset * sizeof(uint32_t)), (int)count);
+    }
+
+    void Renderer::DrawStaticBatchID(StaticBatch& batch, const Camera& cam, uint32_t idBase) {
+        s_PickShader->Bind();
+        s_PickShader->SetUniformMat4f("u_View", cam.GetViewMatrix());
+        s_PickShader->SetUniformMat4f("u_Proj", cam.GetProjectionMatrix());
+        s_PickShader->SetUniform1i("u_Instanced", 0);
+        s_PickShader->SetUniform1ui("u_IDBase", idBase);
+        batch.Draw(*s_PickShader, nullptr, false);
+        glBindVertexArray(s_VAO);
+    }
+
+    void Renderer::DrawStaticBatch(StaticBatch& batch, const Camera& cam, const uint8_t* visible) {
+        s_Shader->Bind();
+        // Vertices are already in world space
+        s_Shader->SetUniformMat4f("u_Model", glm::mat4(1.0f));
         s_Shader->SetUniformMat4f("u_View", cam.GetViewMatrix());
         s_Shader->SetUniformMat4f("u_Proj", cam.GetProjectionMatrix());
+        batch.Draw(*s_Shader, visible);
+        glBindVertexArray(s_VAO);
+    }
+
+    void Renderer::DrawParticles(ParticleSystem& particles, const Camera& cam, const ParticleEmitter& emitter) {
+        particles.Draw(cam, emitter);
         glBindVertexArray(s_VAO);
-        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, nullptr);
+    }
+
+    const Mesh& Renderer::GetCubeMesh() {
+        return *s_CubeMesh;
+    }
+
+    const MeshLODChain& Renderer::GetCubeLODChain() {
+        return *s_CubeLODs;
+    }
+
+    float Renderer::GetCubeBoundingRadius() {
+        return 0.8660254f; // half-diagonal of the unit cube
     }
 
     void Renderer::SetCameraPerspective(Camera& cam, float aspect) {
@@ -103,9 +512,33 @@ namespace Groove {
     }
 
     void Renderer::Shutdown() {
+        delete s_DrawPackets; // packets are plain data, any still queued go with their chunk
+        s_DrawPackets = nullptr;
+        s_DrawQueueHead = s_DrawQueueTail = nullptr;
+        s_DrawQueueCount = 0;
+        delete s_Lighting;
+        s_Lighting = nullptr;
+        delete s_Shadows;
+        s_Shadows = nullptr;
+        delete s_ShadowShader;
+        delete s_Sun;
+        s_Sun = nullptr;
         delete s_Shader;
+        delete s_PickShader;
+        if (s_PickModelSSBO) {
+            glDeleteBuffers(1, &s_PickModelSSBO);
+            MemoryTracker::TrackGpuFree(MemTag::Renderer, (int64_t)s_PickModelCapacity * sizeof(glm::mat4));
+            s_PickModelSSBO = 0;
+            s_PickModelCapacity = 0;
+        }
         glDeleteVertexArrays(1, &s_VAO);
         glDeleteBuffers(1, &s_VBO);
+        glDeleteBuffers(1, &s_IBO);
+        MemoryTracker::TrackGpuFree(MemTag::Renderer, sizeof(cubeVerts) + s_CubeLODs->Indices.size() * sizeof(uint32_t));
+        delete s_CubeLODs;
+        s_CubeLODs = nullptr;
+        delete s_CubeMesh;
+        s_CubeMesh = nullptr;
         Logger::Info("Renderer shutdown.");
     }
 
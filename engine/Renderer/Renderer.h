@@ -1,14 +1,70 @@
 #pragma once  
 
+#include <cstdint>
+
 namespace Groove {  
 
+    struct Mesh;
+    struct MeshLODChain;
+    class StaticBatch;
+    class ParticleSystem;
+    struct ParticleEmitter;
+    struct PointLight;
+    struct ClusterStats;
+    struct DirectionalLight;
+    struct ShadowStats;
+
     class Renderer {  
     public:  
         // Call once after GL and window init  
         static void Init();  
 
-        // Draw a cube with transform and camera  
-        static void DrawCube(const class Transform& t, const class Camera& cam);  
+        // Once per frame before drawing: culls lights into clusters and binds the forward shader
+        static void BeginScene(const class Camera& cam, int viewportWidth, int viewportHeight);
+        // After the opaque forward draws: flushes queued cubes and closes the GPU timer BeginScene
+        // opened (ShadingGpuMs)
+        static void EndScene();
+
+        // Dynamic point lights used by the clustered forward shader (copied)
+        static void SetLights(const PointLight* lights, uint32_t count);
+        // Loop over every light per fragment instead of the cluster's list (for comparison)
+        static void SetNaiveLighting(bool naive);
+        static const ClusterStats& GetLightingStats();
+
+        // Sun used by the forward shader (copied)
+        static void SetDirectionalLight(const DirectionalLight& light);
+        // Cascaded shadow depth passes for the sun; call before BeginScene. The dynamic objects are
+        // unit cubes; staticBatch may be null. Frames without this call are drawn unshadowed.
+        static void RenderShadows(const class Camera& cam, const class Transform* dynamicObjects, uint32_t dynamicCount,
+                                  StaticBatch* staticBatch);
+        // Re-render the far static-only cascades only when needed (see CascadedShadowMap)
+        static void SetShadowCaching(bool enabled);
+        static const ShadowStats& GetShadowStats();
+
+        // Queue a cube with transform and camera (lod indexes GetCubeLODChain().Levels). Cubes are
+        // drawn by FlushDraws, which EndScene calls; cam must not change before then.
+        static void DrawCube(const class Transform& t, const class Camera& cam, uint32_t lod = 0);  
+        // Issue the queued cubes now with the shared state set once
+        static void FlushDraws();
+
+        // Entity-ID draws for GPUPicker (call between GPUPicker::BeginPass/EndPass). Each is a single
+        // draw whatever the object count. Cubes get ids idBase + index, instanced from their
+        // composed matrices. Static objects get idBase + their StaticBatch::Add index.
+        static void DrawCubesID(const class Transform* transforms, uint32_t count, const class Camera& cam, uint32_t idBase = 0);
+        static void DrawStaticBatchID(StaticBatch& batch, const class Camera& cam, uint32_t idBase);
+
+        // Draw merged static geometry (one multi-draw per material), see StaticBatch::Draw
+        static void DrawStaticBatch(StaticBatch& batch, const class Camera& cam, const uint8_t* visible = nullptr);
+
+        // Draw GPU particles as additive billboards, see ParticleSystem::Draw
+        static void DrawParticles(ParticleSystem& particles, const class Camera& cam, const ParticleEmitter& emitter);
+
+        // CPU copy of the cube geometry, e.g. for feeding a StaticBatch
+        static const Mesh& GetCubeMesh();
+
+        // LOD chain generated for the cube at Init, and LOD 0's bounding-sphere radius
+        static const MeshLODChain& GetCubeLODChain();
+        static float GetCubeBoundingRadius();
 
         // Set the camera perspective with aspect ratio
         static void SetCameraPerspective(class Camera& cam, float aspect);
@@ -19,6 +75,18 @@ namespace Groove {
     private:  
         static unsigned int s_VAO, s_VBO, s_IBO;
         static class Shader* s_Shader;  
+        static class Shader* s_PickShader;
+        static const unsigned int PickModelBinding = 3;   // SSBO binding of the instanced ID pass
+        static unsigned int s_PickModelSSBO;
+        static uint32_t s_PickModelCapacity;
+        static Mesh* s_CubeMesh;
+        static MeshLODChain* s_CubeLODs;
+        static class ClusteredLighting* s_Lighting;
+        static bool s_NaiveLighting;
+        static class CascadedShadowMap* s_Shadows;
+        static class Shader* s_ShadowShader;
+        static DirectionalLight* s_Sun;
+        static bool s_ShadowsRendered;
     };  
 
 }
@@ -1,22 +1,20 @@
 #include "Shader.h"
 #include <glad/glad.h>
+#include <cstring>
 #include <iostream>
 #include <glm/gtc/type_ptr.hpp>
 #include "../Utils/Logger.h" 
 
 namespace Groove {
 
-    static int GetUniformLocation(uint32_t program, const std::string& name) {
-        int loc = glGetUniformLocation(program, name.c_str());
-        if (loc == -1)
-            std::cerr << "[Shader] Warning: uniform '" << name << "' not found!\n";
-        return loc;
-    }
-
     Shader::Shader(const std::string& vertSrc, const std::string& fragSrc) {
         m_RendererID = CreateShaderProgram(vertSrc, fragSrc);
     }
 
+    Shader::Shader(const std::string& computeSrc) {
+        m_RendererID = CreateComputeProgram(computeSrc);
+    }
+
     Shader::~Shader() {
         glDeleteProgram(m_RendererID);
     }
@@ -46,7 +44,26 @@ namespace Groove {
         glAttachShader(program, v);
         glAttachShader(program, f);
         glLinkProgram(program);
+        CheckLinkStatus(program);
+
+        glDeleteShader(v);
+        glDeleteShader(f);
+        return program;
+    }
+
+    uint32_t Shader::CreateComputeProgram(const std::string& cs) {
+        uint32_t program = glCreateProgram();
+        uint32_t c = CompileShader(GL_COMPUTE_SHADER, cs);
+
+        glAttachShader(program, c);
+        glLinkProgram(program);
+        CheckLinkStatus(program);
 
+        glDeleteShader(c);
+        return program;
+    }
+
+    void Shader::CheckLinkStatus(uint32_t program) {
         int success;
         glGetProgramiv(program, GL_LINK_STATUS, &success);
         if (!success) {
@@ -56,24 +73,54 @@ namespace Groove {
             glGetProgramInfoLog(program, length, &length, &msg[0]);
             std::cerr << "[Shader] Link error: " << msg << "\n";
         }
-
-        glDeleteShader(v);
-        glDeleteShader(f);
-        return program;
     }
 
     void Shader::Bind() const { glUseProgram(m_RendererID); }
     void Shader::Unbind() const { glUseProgram(0); }
 
-    void Shader::SetUniform1i(const std::string& name, int value) {
-        glUniform1i(GetUniformLocation(m_RendererID, name), value);
+    // Looked up once per name; missing uniforms are cached as -1 so the warning only shows once
+    int Shader::GetUniformLocation(const char* name) {
+        for (const UniformLocation& uniform : m_UniformLocationCache) {
+            if (std::strcmp(uniform.Name.c_str(), name) == 0)
+                return uniform.Location;
+        }
+
+        int loc = glGetUniformLocation(m_RendererID, name);
+        if (loc == -1)
+            std::cerr << "[Shader] Warning: uniform '" << name << "' not found!\n";
+        m_UniformLocationCache.push_back({ name, loc });
+        return loc;
+    }
+
+    void Shader::SetUniform1i(const char* name, int value) {
+        glUniform1i(GetUniformLocation(name), value);
+    }
+
+    void Shader::SetUniform1f(const char* name, float value) {
+        glUniform1f(GetUniformLocation(name), value);
+    }
+
+    void Shader::SetUniform2f(const char* name, float x, float y) {
+        glUniform2f(GetUniformLocation(name), x, y);
+    }
+
+    void Shader::SetUniform3f(const char* name, const glm::vec3& value) {
+        glUniform3f(GetUniformLocation(name), value.x, value.y, value.z);
+    }
+
+    void Shader::SetUniform3i(const char* name, int x, int y, int z) {
+        glUniform3i(GetUniformLocation(name), x, y, z);
+    }
+
+    void Shader::SetUniform4f(const char* name, const glm::vec4& value) {
+        glUniform4f(GetUniformLocation(name), value.x, value.y, value.z, value.w);
     }
 
-    void Shader::SetUniform1f(const std::string& name, float value) {
-        glUniform1f(GetUniformLocation(m_RendererID, name), value);
+    void Shader::SetUniform1ui(const char* name, uint32_t value) {
+        glUniform1ui(GetUniformLocation(name), value);
     }
 
-    void Shader::SetUniformMat4f(const std::string& name, const glm::mat4& matrix) {
-        glUniformMatrix4fv(GetUniformLocation(m_RendererID, name), 1, GL_FALSE, glm::value_ptr(matrix));
+    void Shader::SetUniformMat4f(const char* name, const glm::mat4& matrix) {
+        glUniformMatrix4fv(GetUniformLocation(name), 1, GL_FALSE, glm::value_ptr(matrix));
     }
 }
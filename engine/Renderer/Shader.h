@@ -1,6 +1,6 @@
 #pragma once
 #include <string>
-#include <unordered_map>
+#include <vector>
 #include <glm/glm.hpp>  
 
 namespace Groove {
@@ -8,22 +8,40 @@ namespace Groove {
     class Shader {
     public:
         Shader(const std::string& vertexSrc, const std::string& fragmentSrc);
+        // Compute-only program
+        explicit Shader(const std::string& computeSrc);
         ~Shader();
 
         void Bind() const;
         void Unbind() const;
 
-        // (Optional) Uniform helpers
-        void SetUniform1i(const std::string& name, int value);
-        void SetUniform1f(const std::string& name, float value);
-        void SetUniformMat4f(const std::string& name, const glm::mat4& matrix);
+        // (Optional) Uniform helpers. Names are C strings so per-frame calls never build a
+        // std::string (names past the small-string buffer would hit the heap every call).
+        void SetUniform1i(const char* name, int value);
+        void SetUniform1f(const char* name, float value);
+        void SetUniform2f(const char* name, float x, float y);
+        void SetUniform3f(const char* name, const glm::vec3& value);
+        void SetUniform3i(const char* name, int x, int y, int z);
+        void SetUniform4f(const char* name, const glm::vec4& value);
+        void SetUniform1ui(const char* name, uint32_t value);
+        void SetUniformMat4f(const char* name, const glm::mat4& matrix);
+
+        // Cached location, for callers that set the same uniform in a tight loop
+        int GetUniformLocation(const char* name);
 
     private:
         uint32_t CompileShader(uint32_t type, const std::string& source);
         uint32_t CreateShaderProgram(const std::string& vertSrc, const std::string& fragSrc);
+        uint32_t CreateComputeProgram(const std::string& computeSrc);
+        void CheckLinkStatus(uint32_t program);
 
         uint32_t m_RendererID;
-        std::unordered_map<std::string, int> m_UniformLocationCache;
+        // A program has a few dozen uniforms at most, so a linear scan beats hashing a temporary
+        struct UniformLocation {
+            std::string Name;
+            int Location;
+        };
+        std::vector<UniformLocation> m_UniformLocationCache;
     };
 
 }
@@ -0,0 +1,202 @@
+#include "StaticBatch.h"
+#include "Shader.h"
+#include "../Utils/JobSystem.h"
+#include "../Utils/Logger.h"
+#include "../Utils/Memory.h"
+#include "../Utils/MemoryTracker.h"
+
+#include <glad/glad.h>
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+
+namespace Groove {
+
+    StaticBatch::~StaticBatch() {
+        Clear();
+    }
+
+    uint32_t StaticBatch::AddMaterial(const glm::vec3& albedo) {
+        m_Materials.push_back(albedo);
+        return (uint32_t)m_Materials.size() - 1;
+    }
+
+    void StaticBatch::Add(const Mesh& mesh, const glm::mat4& model, uint32_t materialID) {
+        m_Pending.push_back({ &mesh, model, materialID });
+    }
+
+    void StaticBatch::Build() {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        ReleaseBuffers();
+        m_Version++;
+
+        const uint32_t objectCount = (uint32_t)m_Pending.size();
+        if (objectCount == 0)
+            return;
+
+        // Group by material (stable, so objects keep their Add order inside a group)
+        std::vector<uint32_t> order(objectCount);
+        for (uint32_t i = 0; i < objectCount; i++)
+            order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+            return m_Pending[a].MaterialID < m_Pending[b].MaterialID;
+        });
+
+        // Prefix sums give every object its slice of the merged buffers
+        std::vector<uint32_t> vertexBase(objectCount), indexBase(objectCount);
+        uint32_t vertexCount = 0, indexCount = 0;
+        m_Ranges.resize(objectCount);
+        m_Groups.clear();
+        for (uint32_t i = 0; i < objectCount; i++) {
+            const PendingInstance& inst = m_Pending[order[i]];
+            vertexBase[i] = vertexCount;
+            indexBase[i] = indexCount;
+            m_Ranges[i] = { indexCount, (uint32_t)inst.Source->Indices.size(), order[i] };
+            vertexCount += (uint32_t)inst.Source->Positions.size();
+            indexCount += (uint32_t)inst.Source->Indices.size();
+
+            if (m_Groups.empty() || m_Groups.back().MaterialID != inst.MaterialID)
+                m_Groups.push_back({ inst.MaterialID, i, 0 });
+            m_Groups.back().RangeCount++;
+        }
+
+        // Pre-transform into world space; objects write disjoint slices so this runs in parallel
+        std::vector<glm::vec3> vertices(vertexCount);
+        std::vector<uint32_t> indices(indexCount);
+        std::vector<uint32_t> objectIDs(vertexCount);
+        m_ObjectMin.assign(objectCount, glm::vec3(FLT_MAX));
+        m_ObjectMax.assign(objectCount, glm::vec3(-FLT_MAX));
+        JobSystem::ParallelFor(objectCount, 256, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; i++) {
+                const PendingInstance& inst = m_Pending[order[i]];
+                const Mesh& mesh = *inst.Source;
+                glm::vec3& objectMin = m_ObjectMin[order[i]];
+                glm::vec3& objectMax = m_ObjectMax[order[i]];
+                for (size_t v = 0; v < mesh.Positions.size(); v++) {
+                    glm::vec3 world = glm::vec3(inst.Model * glm::vec4(mesh.Positions[v], 1.0f));
+                    vertices[vertexBase[i] + v] = world;
+                    objectIDs[vertexBase[i] + v] = order[i];
+                    objectMin = glm::min(objectMin, world);
+                    objectMax = glm::max(objectMax, world);
+                }
+                for (size_t k = 0; k < mesh.Indices.size(); k++)
+                    indices[indexBase[i] + k] = mesh.Indices[k] + vertexBase[i];
+            }
+        });
+
+        glGenVertexArrays(1, &m_VAO);
+        glBindVertexArray(m_VAO);
+
+        glGenBuffers(1, &m_VBO);
+        glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(glm::vec3), vertices.data(), GL_STATIC_DRAW);
+
+        glGenBuffers(1, &m_IBO);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IBO);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(uint32_t), indices.data(), GL_STATIC_DRAW);
+
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), (void*)0);
+
+        // Object index per vertex for ID passes; shaders that don't declare location 1 ignore it
+        glGenBuffers(1, &m_IDBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, m_IDBuffer);
+        glBufferData(GL_ARRAY_BUFFER, objectIDs.size() * sizeof(uint32_t), objectIDs.data(), GL_STATIC_DRAW);
+        glEnableVertexAttribArray(1);
+        glVertexAttribIPointer(1, 1, GL_UNSIGNED_INT, sizeof(uint32_t), (void*)0);
+        glBindVertexArray(0);
+
+        m_GpuBytes = (int64_t)(vertices.size() * sizeof(glm::vec3) + (indices.size() + objectIDs.size()) * sizeof(uint32_t));
+        MemoryTracker::TrackGpuAlloc(MemTag::Scene, m_GpuBytes);
+
+        m_Stats.ObjectCount = objectCount;
+        m_Stats.MaterialCount = (uint32_t)m_Groups.size();
+        m_Stats.BuildMs = std::chrono::duration<float, std::milli>(
+            std::chrono::high_resolution_clock::now() - start).count();
+
+        Logger::Info("Static batch built: " + std::to_string(objectCount) + " objects, "
+                     + std::to_string(vertexCount) + " vertices, " + std::to_string(m_Groups.size()) + " materials.");
+    }
+
+    void StaticBatch::ReleaseBuffers() {
+        if (!m_VAO)
+            return;
+        glDeleteVertexArrays(1, &m_VAO);
+        glDeleteBuffers(1, &m_VBO);
+        glDeleteBuffers(1, &m_IBO);
+        glDeleteBuffers(1, &m_IDBuffer);
+        m_VAO = m_VBO = m_IBO = m_IDBuffer = 0;
+        MemoryTracker::TrackGpuFree(MemTag::Scene, m_GpuBytes);
+        m_GpuBytes = 0;
+    }
+
+    void StaticBatch::Clear() {
+        ReleaseBuffers();
+        m_Materials.clear();
+        m_Pending.clear();
+        m_Ranges.clear();
+        m_Groups.clear();
+        m_ObjectMin.clear();
+        m_ObjectMax.clear();
+        m_Version++;
+        m_Stats = StaticBatchStats();
+    }
+
+    void StaticBatch::Draw(Shader& shader, const uint8_t* visible, bool bindMaterials) {
+        if (!m_VAO)
+            return;
+        auto start = std::chrono::high_resolution_clock::now();
+
+        glBindVertexArray(m_VAO);
+        uint32_t drawCalls = 0, subDraws = 0;
+
+        // Multi-draw arguments are frame temporaries
+        LinearArena& arena = Memory::GetFrameArena();
+        ArenaVector<int> drawCounts{ ArenaAllocator<int>(arena) };
+        ArenaVector<const void*> drawOffsets{ ArenaAllocator<const void*>(arena) };
+
+        for (const MaterialGroup& group : m_Groups) {
+            drawCounts.clear();
+            drawOffsets.clear();
+            drawCounts.reserve(group.RangeCount);
+            drawOffsets.reserve(group.RangeCount);
+
+            // Ranges within a group are contiguous in the IBO, so neighbours merge into one
+            uint32_t runStart = 0, runCount = 0;
+            for (uint32_t r = group.FirstRange; r < group.FirstRange + group.RangeCount; r++) {
+                const DrawRange& range = m_Ranges[r];
+                if (visible && !visible[range.Object]) {
+                    if (runCount) {
+                        drawCounts.push_back((int)runCount);
+                        drawOffsets.push_back((const void*)(uintptr_t)(runStart * sizeof(uint32_t)));
+                        runCount = 0;
+                    }
+                    continue;
+                }
+                if (runCount == 0)
+                    runStart = range.IndexOffset;
+                runCount += range.IndexCount;
+            }
+            if (runCount) {
+                drawCounts.push_back((int)runCount);
+                drawOffsets.push_back((const void*)(uintptr_t)(runStart * sizeof(uint32_t)));
+            }
+            if (drawCounts.empty())
+                continue;
+
+            if (bindMaterials)
+                shader.SetUniform3f("u_Albedo", m_Materials[group.MaterialID]);
+            glMultiDrawElements(GL_TRIANGLES, drawCounts.data(), GL_UNSIGNED_INT,
+                                drawOffsets.data(), (int)drawCounts.size());
+            drawCalls++;
+            subDraws += (uint32_t)drawCounts.size();
+        }
+
+        m_Stats.DrawCalls = drawCalls;
+        m_Stats.SubDraws = subDraws;
+        m_Stats.SubmitMs = std::chrono::duration<float, std::milli>(
+            std::chrono::high_resolution_clock::now() - start).count();
+    }
+
+}
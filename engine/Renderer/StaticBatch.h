@@ -0,0 +1,93 @@
+#pragma once
+
+#include "Mesh.h"
+#include <cstdint>
+#include <vector>
+
+namespace Groove {
+
+    class Shader;
+
+    struct StaticBatchStats {
+        uint32_t ObjectCount = 0;
+        uint32_t MaterialCount = 0;
+        uint32_t DrawCalls = 0;        // glMultiDrawElements calls issued by the last Draw
+        uint32_t SubDraws = 0;         // ranges submitted through those calls
+        float    BuildMs = 0.0f;
+        float    SubmitMs = 0.0f;      // CPU time of the last Draw
+    };
+
+    // Pre-transforms geometry that never moves into one shared vertex/index buffer, grouped
+    // by material, and draws each material with a single glMultiDrawElements.
+    // Every vertex also carries its object's Add-order index as an integer attribute (location 1),
+    // so an entity-ID pass can reuse the same multi-draws (see Renderer::DrawStaticBatchID).
+    class StaticBatch {
+    public:
+        StaticBatch() = default;
+        ~StaticBatch();
+
+        StaticBatch(const StaticBatch&) = delete;
+        StaticBatch& operator=(const StaticBatch&) = delete;
+
+        // Returns the material id to pass to Add
+        uint32_t AddMaterial(const glm::vec3& albedo);
+
+        // Queues a mesh instance; nothing is uploaded until Build
+        void Add(const Mesh& mesh, const glm::mat4& model, uint32_t materialID);
+
+        // Merges everything queued so far into the GPU buffers (replaces the previous build)
+        void Build();
+
+        // Frees GPU buffers, the queued instances and the materials
+        void Clear();
+
+        // visible: optional per-object mask in Add order; hidden objects are skipped and
+        // adjacent visible objects are coalesced into one range. Depth-only passes pass
+        // bindMaterials = false so the shader needs no u_Albedo.
+        void Draw(Shader& shader, const uint8_t* visible = nullptr, bool bindMaterials = true);
+
+        bool IsBuilt() const { return m_VAO != 0; }
+        uint32_t GetObjectCount() const { return (uint32_t)m_Pending.size(); }
+        const StaticBatchStats& GetStats() const { return m_Stats; }
+
+        // World AABB per object in Add order, valid after Build
+        const glm::vec3* GetObjectMin() const { return m_ObjectMin.data(); }
+        const glm::vec3* GetObjectMax() const { return m_ObjectMax.data(); }
+        // Bumped by every Build and Clear, so caches of the static content can tell it changed
+        uint32_t GetVersion() const { return m_Version; }
+
+    private:
+        void ReleaseBuffers();
+
+        struct PendingInstance {
+            const Mesh* Source;
+            glm::mat4   Model;
+            uint32_t    MaterialID;
+        };
+
+        // Compact per-object draw table entry, sorted by material
+        struct DrawRange {
+            uint32_t IndexOffset;
+            uint32_t IndexCount;
+            uint32_t Object;       // index into m_Pending (for the visibility mask)
+        };
+
+        struct MaterialGroup {
+            uint32_t  MaterialID;
+            uint32_t  FirstRange;
+            uint32_t  RangeCount;
+        };
+
+        std::vector<glm::vec3>       m_Materials;
+        std::vector<PendingInstance> m_Pending;
+        std::vector<DrawRange>       m_Ranges;
+        std::vector<MaterialGroup>   m_Groups;
+        std::vector<glm::vec3>       m_ObjectMin, m_ObjectMax;
+        uint32_t                     m_Version = 0;
+
+        uint32_t m_VAO = 0, m_VBO = 0, m_IBO = 0, m_IDBuffer = 0;
+        int64_t  m_GpuBytes = 0;
+        StaticBatchStats m_Stats;
+    };
+
+}
@@ -0,0 +1,475 @@
+#include "BatchMath.h"
+#include "BatchMathKernels.h"
+#include "Logger.h"
+#include "../src/Transform.hpp"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtx/euler_angles.hpp>
+
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#if GROOVE_BATCHMATH_X86
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+namespace Groove {
+namespace BatchMathKernels {
+
+    void ComposeScalar(const TransformArrays& in, uint32_t begin, uint32_t end, glm::mat4* out) {
+        for (uint32_t i = begin; i < end; i++) {
+            float sp = std::sin(in.RotX[i] * DegToRad), cp = std::cos(in.RotX[i] * DegToRad);
+            float sh = std::sin(in.RotY[i] * DegToRad), ch = std::cos(in.RotY[i] * DegToRad);
+            float sb = std::sin(in.RotZ[i] * DegToRad), cb = std::cos(in.RotZ[i] * DegToRad);
+            float* m = &out[i][0][0];
+            m[0] = (ch * cb + sh * sp * sb) * in.ScaleX[i];
+            m[1] = sb * cp * in.ScaleX[i];
+            m[2] = (-sh * cb + ch * sp * sb) * in.ScaleX[i];
+            m[3] = 0.0f;
+            m[4] = (-ch * sb + sh * sp * cb) * in.ScaleY[i];
+            m[5] = cb * cp * in.ScaleY[i];
+            m[6] = (sb * sh + ch * sp * cb) * in.ScaleY[i];
+            m[7] = 0.0f;
+            m[8] = sh * cp * in.ScaleZ[i];
+            m[9] = -sp * in.ScaleZ[i];
+            m[10] = ch * cp * in.ScaleZ[i];
+            m[11] = 0.0f;
+            m[12] = in.PosX[i];
+            m[13] = in.PosY[i];
+            m[14] = in.PosZ[i];
+            m[15] = 1.0f;
+        }
+    }
+
+    void MultiplyScalar(const glm::mat4& lhs, const glm::mat4* in, uint32_t begin, uint32_t end, glm::mat4* out) {
+        const float* a = &lhs[0][0];
+        for (uint32_t i = begin; i < end; i++) {
+            const float* b = &in[i][0][0];
+            float* r = &out[i][0][0];
+            for (int c = 0; c < 4; c++) {
+                for (int row = 0; row < 4; row++)
+                    r[c * 4 + row] = a[row] * b[c * 4] + a[4 + row] * b[c * 4 + 1] + a[8 + row] * b[c * 4 + 2] + a[12 + row] * b[c * 4 + 3];
+            }
+        }
+    }
+
+    void TransformAABBsScalar(const glm::mat4* matrices, const AABBArrays& local, uint32_t begin, uint32_t end,
+                              const AABBArrays& out) {
+        float* outMin[3] = { out.MinX, out.MinY, out.MinZ };
+        float* outMax[3] = { out.MaxX, out.MaxY, out.MaxZ };
+        for (uint32_t i = begin; i < end; i++) {
+            const glm::mat4& m = matrices[i];
+            float c[3] = { (local.MinX[i] + local.MaxX[i]) * 0.5f, (local.MinY[i] + local.MaxY[i]) * 0.5f,
+                           (local.MinZ[i] + local.MaxZ[i]) * 0.5f };
+            float e[3] = { (local.MaxX[i] - local.MinX[i]) * 0.5f, (local.MaxY[i] - local.MinY[i]) * 0.5f,
+                           (local.MaxZ[i] - local.MinZ[i]) * 0.5f };
+            for (int row = 0; row < 3; row++) {
+                float center = m[0][row] * c[0] + m[1][row] * c[1] + m[2][row] * c[2] + m[3][row];
+                float extent = std::abs(m[0][row]) * e[0] + std::abs(m[1][row]) * e[1] + std::abs(m[2][row]) * e[2];
+                outMin[row][i] = center - extent;
+                outMax[row][i] = center + extent;
+            }
+        }
+    }
+
+    void SinCosScalar(const float* angles, uint32_t begin, uint32_t end, float* outSin, float* outCos) {
+        for (uint32_t i = begin; i < end; i++) {
+            outSin[i] = std::sin(angles[i]);
+            outCos[i] = std::cos(angles[i]);
+        }
+    }
+
+    const Kernels Scalar = { ComposeScalar, MultiplyScalar, TransformAABBsScalar, SinCosScalar };
+
+#if GROOVE_BATCHMATH_X86
+    static inline void SinCos4(__m128 x, __m128& outSin, __m128& outCos) {
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+        __m128 sinSign = _mm_and_ps(x, signMask);
+        x = _mm_andnot_ps(signMask, x);
+
+        // Octant j (rounded up to even) and the remainder in [-pi/4, pi/4]
+        __m128i j = _mm_cvttps_epi32(_mm_mul_ps(x, _mm_set1_ps(FourOverPi)));
+        j = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+        __m128 y = _mm_cvtepi32_ps(j);
+        __m128 sinFlip = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, _mm_set1_epi32(4)), 29));
+        __m128 cosFlip = _mm_castsi128_ps(_mm_slli_epi32(_mm_andnot_si128(_mm_sub_epi32(j, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));
+        __m128 useSinPoly = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, _mm_set1_epi32(2)), _mm_setzero_si128()));
+
+        x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(DP1)));
+        x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(DP2)));
+        x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(DP3)));
+        __m128 z = _mm_mul_ps(x, x);
+
+        __m128 cosPoly = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(CosC0), z), _mm_set1_ps(CosC1));
+        cosPoly = _mm_add_ps(_mm_mul_ps(cosPoly, z), _mm_set1_ps(CosC2));
+        cosPoly = _mm_mul_ps(_mm_mul_ps(cosPoly, z), z);
+        cosPoly = _mm_add_ps(_mm_sub_ps(cosPoly, _mm_mul_ps(z, _mm_set1_ps(0.5f))), _mm_set1_ps(1.0f));
+
+        __m128 sinPoly = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(SinC0), z), _mm_set1_ps(SinC1));
+        sinPoly = _mm_add_ps(_mm_mul_ps(sinPoly, z), _mm_set1_ps(SinC2));
+        sinPoly = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(sinPoly, z), x), x);
+
+        __m128 s = _mm_or_ps(_mm_and_ps(useSinPoly, sinPoly), _mm_andnot_ps(useSinPoly, cosPoly));
+        __m128 c = _mm_or_ps(_mm_and_ps(useSinPoly, cosPoly), _mm_andnot_ps(useSinPoly, sinPoly));
+        outSin = _mm_xor_ps(s, _mm_xor_ps(sinSign, sinFlip));
+        outCos = _mm_xor_ps(c, cosFlip);
+    }
+
+    // Rows r0..r3 hold one matrix column for four objects; write that column into each object's matrix
+    static inline void StoreColumn4(float* base, int column, __m128 r0, __m128 r1, __m128 r2, __m128 r3) {
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        _mm_storeu_ps(base + column * 4, r0);
+        _mm_storeu_ps(base + 16 + column * 4, r1);
+        _mm_storeu_ps(base + 32 + column * 4, r2);
+        _mm_storeu_ps(base + 48 + column * 4, r3);
+    }
+
+    static void ComposeSSE(const TransformArrays& in, uint32_t begin, uint32_t end, glm::mat4* out) {
+        const __m128 degToRad = _mm_set1_ps(DegToRad);
+        const __m128 zero = _mm_setzero_ps();
+        uint32_t i = begin;
+        for (; i + 4 <= end; i += 4) {
+            __m128 sp, cp, sh, ch, sb, cb;
+            SinCos4(_mm_mul_ps(_mm_loadu_ps(in.RotX + i), degToRad), sp, cp);
+            SinCos4(_mm_mul_ps(_mm_loadu_ps(in.RotY + i), degToRad), sh, ch);
+            SinCos4(_mm_mul_ps(_mm_loadu_ps(in.RotZ + i), degToRad), sb, cb);
+            __m128 sx = _mm_loadu_ps(in.ScaleX + i), sy = _mm_loadu_ps(in.ScaleY + i), sz = _mm_loadu_ps(in.ScaleZ + i);
+            __m128 shsp = _mm_mul_ps(sh, sp), chsp = _mm_mul_ps(ch, sp);
+
+            float* base = &out[i][0][0];
+            StoreColumn4(base, 0,
+                _mm_mul_ps(_mm_add_ps(_mm_mul_ps(ch, cb), _mm_mul_ps(shsp, sb)), sx),
+                _mm_mul_ps(_mm_mul_ps(sb, cp), sx),
+                _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(chsp, sb), _mm_mul_ps(sh, cb)), sx),
+                zero);
+            StoreColumn4(base, 1,
+                _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(shsp, cb), _mm_mul_ps(ch, sb)), sy),
+                _mm_mul_ps(_mm_mul_ps(cb, cp), sy),
+                _mm_mul_ps(_mm_add_ps(_mm_mul_ps(sb, sh), _mm_mul_ps(chsp, cb)), sy),
+                zero);
+            StoreColumn4(base, 2,
+                _mm_mul_ps(_mm_mul_ps(sh, cp), sz),
+                _mm_mul_ps(_mm_sub_ps(zero, sp), sz),
+                _mm_mul_ps(_mm_mul_ps(ch, cp), sz),
+                zero);
+            StoreColumn4(base, 3, _mm_loadu_ps(in.PosX + i), _mm_loadu_ps(in.PosY + i), _mm_loadu_ps(in.PosZ + i),
+                         _mm_set1_ps(1.0f));
+        }
+        ComposeScalar(in, i, end, out);
+    }
+
+    static void MultiplySSE(const glm::mat4& lhs, const glm::mat4* in, uint32_t begin, uint32_t end, glm::mat4* out) {
+        const float* a = &lhs[0][0];
+        __m128 a0 = _mm_loadu_ps(a), a1 = _mm_loadu_ps(a + 4), a2 = _mm_loadu_ps(a + 8), a3 = _mm_loadu_ps(a + 12);
+        for (uint32_t i = begin; i < end; i++) {
+            const float* b = &in[i][0][0];
+            float* r = &out[i][0][0];
+            for (int c = 0; c < 4; c++) {
+                __m128 col = _mm_loadu_ps(b + c * 4);
+                __m128 v = _mm_mul_ps(a0, _mm_shuffle_ps(col, col, _MM_SHUFFLE(0, 0, 0, 0)));
+                v = _mm_add_ps(v, _mm_mul_ps(a1, _mm_shuffle_ps(col, col, _MM_SHUFFLE(1, 1, 1, 1))));
+                v = _mm_add_ps(v, _mm_mul_ps(a2, _mm_shuffle_ps(col, col, _MM_SHUFFLE(2, 2, 2, 2))));
+                v = _mm_add_ps(v, _mm_mul_ps(a3, _mm_shuffle_ps(col, col, _MM_SHUFFLE(3, 3, 3, 3))));
+                _mm_storeu_ps(r + c * 4, v);
+            }
+        }
+    }
+
+    static void TransformAABBsSSE(const glm::mat4* matrices, const AABBArrays& local, uint32_t begin, uint32_t end,
+                                  const AABBArrays& out) {
+        const __m128 half = _mm_set1_ps(0.5f);
+        const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+        uint32_t i = begin;
+        for (; i + 4 <= end; i += 4) {
+            // m[c][r] for four objects
+            __m128 m[4][4];
+            const float* base = &matrices[i][0][0];
+            for (int c = 0; c < 4; c++) {
+                m[c][0] = _mm_loadu_ps(base + c * 4);
+                m[c][1] = _mm_loadu_ps(base + 16 + c * 4);
+                m[c][2] = _mm_loadu_ps(base + 32 + c * 4);
+                m[c][3] = _mm_loadu_ps(base + 48 + c * 4);
+                _MM_TRANSPOSE4_PS(m[c][0], m[c][1], m[c][2], m[c][3]);
+            }
+
+            __m128 minX = _mm_loadu_ps(local.MinX + i), maxX = _mm_loadu_ps(local.MaxX + i);
+            __m128 minY = _mm_loadu_ps(local.MinY + i), maxY = _mm_loadu_ps(local.MaxY + i);
+            __m128 minZ = _mm_loadu_ps(local.MinZ + i), maxZ = _mm_loadu_ps(local.MaxZ + i);
+            __m128 cx = _mm_mul_ps(_mm_add_ps(minX, maxX), half), ex = _mm_mul_ps(_mm_sub_ps(maxX, minX), half);
+            __m128 cy = _mm_mul_ps(_mm_add_ps(minY, maxY), half), ey = _mm_mul_ps(_mm_sub_ps(maxY, minY), half);
+            __m128 cz = _mm_mul_ps(_mm_add_ps(minZ, maxZ), half), ez = _mm_mul_ps(_mm_sub_ps(maxZ, minZ), half);
+
+            float* outMin[3] = { out.MinX, out.MinY, out.MinZ };
+            float* outMax[3] = { out.MaxX, out.MaxY, out.MaxZ };
+            for (int row = 0; row < 3; row++) {
+                __m128 center = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m[0][row], cx), _mm_mul_ps(m[1][row], cy)),
+                                           _mm_add_ps(_mm_mul_ps(m[2][row], cz), m[3][row]));
+                __m128 extent = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_and_ps(m[0][row], absMask), ex),
+                                                      _mm_mul_ps(_mm_and_ps(m[1][row], absMask), ey)),
+                                           _mm_mul_ps(_mm_and_ps(m[2][row], absMask), ez));
+                _mm_storeu_ps(outMin[row] + i, _mm_sub_ps(center, extent));
+                _mm_storeu_ps(outMax[row] + i, _mm_add_ps(center, extent));
+            }
+        }
+        TransformAABBsScalar(matrices, local, i, end, out);
+    }
+
+    static void SinCosSSE(const float* angles, uint32_t begin, uint32_t end, float* outSin, float* outCos) {
+        uint32_t i = begin;
+        for (; i + 4 <= end; i += 4) {
+            __m128 s, c;
+            SinCos4(_mm_loadu_ps(angles + i), s, c);
+            _mm_storeu_ps(outSin + i, s);
+            _mm_storeu_ps(outCos + i, c);
+        }
+        SinCosScalar(angles, i, end, outSin, outCos);
+    }
+
+    const Kernels SSE = { ComposeSSE, MultiplySSE, TransformAABBsSSE, SinCosSSE };
+#endif
+
+}
+
+    static BatchMathPath s_Path = BatchMathPath::Scalar;
+    static const BatchMathKernels::Kernels* s_Kernels = &BatchMathKernels::Scalar;
+    static bool s_Supported[(int)BatchMathPath::Count] = { true, false, false };
+
+    static bool CpuHasAVX2() {
+#if GROOVE_BATCHMATH_X86
+#ifdef _MSC_VER
+        int info[4];
+        __cpuid(info, 1);
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        bool fma = (info[2] & (1 << 12)) != 0;
+        if (!osxsave || !fma || (_xgetbv(0) & 6) != 6)
+            return false;
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#else
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+#else
+        return false;
+#endif
+    }
+
+    constexpr float BatchMath::ComposeTolerance;
+    constexpr float BatchMath::MultiplyTolerance;
+    constexpr float BatchMath::AABBTolerance;
+    constexpr float BatchMath::SinCosTolerance;
+
+    void BatchMath::Init() {
+#if GROOVE_BATCHMATH_X86
+        s_Supported[(int)BatchMathPath::SSE] = true;
+        s_Supported[(int)BatchMathPath::AVX2] = CpuHasAVX2();
+#endif
+        for (int path = (int)BatchMathPath::Count - 1; path >= 0; path--) {
+            if (s_Supported[path]) {
+                SetPath((BatchMathPath)path);
+                break;
+            }
+        }
+        Logger::Info(std::string("BatchMath path: ") + GetPathName(s_Path));
+    }
+
+    bool BatchMath::IsSupported(BatchMathPath path) {
+        return path < BatchMathPath::Count && s_Supported[(int)path];
+    }
+
+    void BatchMath::SetPath(BatchMathPath path) {
+        if (!IsSupported(path))
+            return;
+        s_Path = path;
+        switch (path) {
+#if GROOVE_BATCHMATH_X86
+            case BatchMathPath::SSE:  s_Kernels = &BatchMathKernels::SSE; break;
+            case BatchMathPath::AVX2: s_Kernels = &BatchMathKernels::AVX2; break;
+#endif
+            default:                  s_Kernels = &BatchMathKernels::Scalar; break;
+        }
+    }
+
+    BatchMathPath BatchMath::GetPath() {
+        return s_Path;
+    }
+
+    const char* BatchMath::GetPathName(BatchMathPath path) {
+        switch (path) {
+            case BatchMathPath::Scalar: return "Scalar";
+            case BatchMathPath::SSE:    return "SSE";
+            case BatchMathPath::AVX2:   return "AVX2";
+            default:                    return "Unknown";
+        }
+    }
+
+    void BatchMath::ComposeMatrices(const TransformArrays& transforms, uint32_t count, glm::mat4* outMatrices) {
+        s_Kernels->Compose(transforms, 0, count, outMatrices);
+    }
+
+    void BatchMath::MultiplyMatrices(const glm::mat4& lhs, const glm::mat4* matrices, uint32_t count, glm::mat4* outMatrices) {
+        s_Kernels->Multiply(lhs, matrices, 0, count, outMatrices);
+    }
+
+    void BatchMath::TransformAABBs(const glm::mat4* matrices, const AABBArrays& local, uint32_t count, const AABBArrays& outWorld) {
+        s_Kernels->TransformAABBs(matrices, local, 0, count, outWorld);
+    }
+
+    void BatchMath::SinCos(const float* angles, uint32_t count, float* outSin, float* outCos) {
+        s_Kernels->SinCos(angles, 0, count, outSin, outCos);
+    }
+
+    void BatchMath::ComposeTransforms(const Transform* transforms, uint32_t count, glm::mat4* outMatrices,
+                                      glm::vec3* outMin, glm::vec3* outMax) {
+        const uint32_t BlockSize = 128;
+        float soa[9][BlockSize];
+        float bounds[6][BlockSize];
+        glm::mat4 blockMatrices[BlockSize];
+        float unitMin[BlockSize], unitMax[BlockSize];
+        std::fill(unitMin, unitMin + BlockSize, -0.5f);
+        std::fill(unitMax, unitMax + BlockSize, 0.5f);
+
+        const TransformArrays in = { soa[0], soa[1], soa[2], soa[3], soa[4], soa[5], soa[6], soa[7], soa[8] };
+        const AABBArrays local = { unitMin, unitMin, unitMin, unitMax, unitMax, unitMax };
+        const AABBArrays world = { bounds[0], bounds[1], bounds[2], bounds[3], bounds[4], bounds[5] };
+        for (uint32_t begin = 0; begin < count; begin += BlockSize) {
+            uint32_t n = std::min(BlockSize, count - begin);
+            for (uint32_t i = 0; i < n; i++) {
+                const Transform& t = transforms[begin + i];
+                for (int axis = 0; axis < 3; axis++) {
+                    soa[axis][i] = t.Position[axis];
+                    soa[3 + axis][i] = t.Rotation[axis];
+                    soa[6 + axis][i] = t.Scale[axis];
+                }
+            }
+            glm::mat4* matrices = outMatrices ? outMatrices + begin : blockMatrices;
+            s_Kernels->Compose(in, 0, n, matrices);
+            if (!outMin)
+                continue;
+            s_Kernels->TransformAABBs(matrices, local, 0, n, world);
+            for (uint32_t i = 0; i < n; i++) {
+                outMin[begin + i] = glm::vec3(bounds[0][i], bounds[1][i], bounds[2][i]);
+                outMax[begin + i] = glm::vec3(bounds[3][i], bounds[4][i], bounds[5][i]);
+            }
+        }
+    }
+
+    // Runs fn repeatedly for at least ~20 ms and returns millions of items per second
+    template<typename Fn>
+    static double MeasureThroughput(uint32_t count, Fn fn) {
+        using Clock = std::chrono::high_resolution_clock;
+        uint32_t iterations = 0;
+        Clock::time_point start = Clock::now();
+        double seconds = 0.0;
+        do {
+            fn();
+            iterations++;
+            seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        } while (seconds < 0.02);
+        return (double)count * iterations / seconds / 1.0e6;
+    }
+
+    BatchMathReport BatchMath::Validate(BatchMathPath path, uint32_t count) {
+        BatchMathReport report = {};
+        report.Path = path;
+        if (!IsSupported(path))
+            return report;
+
+        BatchMathPath previous = s_Path;
+        SetPath(path);
+
+        // Deterministic pseudo-random transforms covering full rotations and non-uniform scale
+        std::vector<float> soa((size_t)count * 9);
+        uint32_t seed = 0x9E3779B9u;
+        auto next = [&seed]() {
+            seed = seed * 1664525u + 1013904223u;
+            return (float)(seed >> 8) / 16777216.0f;
+        };
+        for (size_t i = 0; i < (size_t)count * 3; i++)
+            soa[i] = (next() - 0.5f) * 200.0f;              // positions
+        for (size_t i = (size_t)count * 3; i < (size_t)count * 6; i++)
+            soa[i] = (next() - 0.5f) * 720.0f;              // degrees
+        for (size_t i = (size_t)count * 6; i < (size_t)count * 9; i++)
+            soa[i] = 0.1f + next() * 4.0f;                  // scales
+        const float* p = soa.data();
+        TransformArrays transforms = { p, p + count, p + 2 * count, p + 3 * count, p + 4 * count, p + 5 * count,
+                                       p + 6 * count, p + 7 * count, p + 8 * count };
+
+        std::vector<glm::mat4> models(count), products(count);
+        std::vector<float> boxes((size_t)count * 12);
+        float* b = boxes.data();
+        AABBArrays local = { b, b + count, b + 2 * count, b + 3 * count, b + 4 * count, b + 5 * count };
+        AABBArrays world = { b + 6 * count, b + 7 * count, b + 8 * count, b + 9 * count, b + 10 * count, b + 11 * count };
+        for (uint32_t i = 0; i < count; i++) {
+            local.MinX[i] = -0.5f; local.MinY[i] = -1.0f; local.MinZ[i] = -0.25f;
+            local.MaxX[i] = 0.5f;  local.MaxY[i] = 0.5f;  local.MaxZ[i] = 0.75f;
+        }
+        glm::mat4 viewProj = glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, 0.1f, 100.0f) *
+                             glm::lookAt(glm::vec3(10.0f, 20.0f, 30.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+        ComposeMatrices(transforms, count, models.data());
+        MultiplyMatrices(viewProj, models.data(), count, products.data());
+        TransformAABBs(models.data(), local, count, world);
+
+        std::vector<float> sines(count), cosines(count);
+        SinCos(transforms.RotY, count, sines.data(), cosines.data());
+
+        for (uint32_t i = 0; i < count; i++) {
+            glm::mat4 reference = glm::translate(glm::mat4(1.0f), glm::vec3(transforms.PosX[i], transforms.PosY[i], transforms.PosZ[i])) *
+                glm::eulerAngleYXZ(glm::radians(transforms.RotY[i]), glm::radians(transforms.RotX[i]), glm::radians(transforms.RotZ[i])) *
+                glm::scale(glm::mat4(1.0f), glm::vec3(transforms.ScaleX[i], transforms.ScaleY[i], transforms.ScaleZ[i]));
+            glm::mat4 product = viewProj * models[i];
+            for (int c = 0; c < 4; c++) {
+                for (int r = 0; r < 4; r++) {
+                    report.ComposeError = std::max(report.ComposeError, std::abs(models[i][c][r] - reference[c][r]));
+                    report.MultiplyError = std::max(report.MultiplyError, std::abs(products[i][c][r] - product[c][r]));
+                }
+            }
+
+            // Reference box: transform all eight corners
+            glm::vec3 lo(FLT_MAX), hi(-FLT_MAX);
+            for (int corner = 0; corner < 8; corner++) {
+                glm::vec4 v((corner & 1) ? local.MaxX[i] : local.MinX[i], (corner & 2) ? local.MaxY[i] : local.MinY[i],
+                            (corner & 4) ? local.MaxZ[i] : local.MinZ[i], 1.0f);
+                glm::vec3 w = glm::vec3(reference * v);
+                lo = glm::min(lo, w);
+                hi = glm::max(hi, w);
+            }
+            const float* worldMin[3] = { world.MinX, world.MinY, world.MinZ };
+            const float* worldMax[3] = { world.MaxX, world.MaxY, world.MaxZ };
+            for (int axis = 0; axis < 3; axis++) {
+                report.AABBError = std::max(report.AABBError, std::abs(worldMin[axis][i] - lo[axis]));
+                report.AABBError = std::max(report.AABBError, std::abs(worldMax[axis][i] - hi[axis]));
+            }
+
+            report.SinCosError = std::max(report.SinCosError, std::abs(sines[i] - std::sin(transforms.RotY[i])));
+            report.SinCosError = std::max(report.SinCosError, std::abs(cosines[i] - std::cos(transforms.RotY[i])));
+        }
+
+        report.ComposeMPerSec = MeasureThroughput(count, [&]() { ComposeMatrices(transforms, count, models.data()); });
+        report.MultiplyMPerSec = MeasureThroughput(count, [&]() { MultiplyMatrices(viewProj, models.data(), count, products.data()); });
+        report.AABBMPerSec = MeasureThroughput(count, [&]() { TransformAABBs(models.data(), local, count, world); });
+
+        report.Passed = report.ComposeError <= ComposeTolerance && report.MultiplyError <= MultiplyTolerance &&
+                        report.AABBError <= AABBTolerance && report.SinCosError <= SinCosTolerance;
+        if (!report.Passed) {
+            char message[256];
+            std::snprintf(message, sizeof(message),
+                          "BatchMath %s failed validation: compose %g (tol %g) | multiply %g (tol %g) | AABB %g (tol %g) | sincos %g (tol %g)",
+                          GetPathName(path), report.ComposeError, ComposeTolerance, report.MultiplyError, MultiplyTolerance,
+                          report.AABBError, AABBTolerance, report.SinCosError, SinCosTolerance);
+            Logger::Error(message);
+        }
+
+        SetPath(previous);
+        return report;
+    }
+
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+
+namespace Groove {
+
+    struct Transform;
+
+    // Structure-of-arrays transform input; rotations are Euler degrees applied like
+    // Transform::GetMatrix (yaw = Y, pitch = X, roll = Z)
+    struct TransformArrays {
+        const float* PosX; const float* PosY; const float* PosZ;
+        const float* RotX; const float* RotY; const float* RotZ;
+        const float* ScaleX; const float* ScaleY; const float* ScaleZ;
+    };
+
+    struct AABBArrays {
+        float* MinX; float* MinY; float* MinZ;
+        float* MaxX; float* MaxY; float* MaxZ;
+    };
+
+    enum class BatchMathPath { Scalar = 0, SSE, AVX2, Count };
+
+    struct BatchMathReport {
+        BatchMathPath Path;
+        // Largest absolute difference from glm over the validation set
+        float ComposeError;
+        float MultiplyError;
+        float AABBError;
+        float SinCosError;
+        // Throughput in millions of items per second
+        double ComposeMPerSec;
+        double MultiplyMPerSec;
+        double AABBMPerSec;
+        // Every error within BatchMath's tolerance for that kernel
+        bool Passed;
+    };
+
+    // Array kernels for transforms with SSE / AVX2+FMA paths picked at runtime.
+    // Outputs may not alias inputs.
+    class BatchMath {
+    public:
+        // Largest absolute difference from glm that Validate accepts; the validation set has
+        // positions up to 100 and scales up to 4, so products reach a few hundred
+        static constexpr float ComposeTolerance = 1e-5f;
+        static constexpr float MultiplyTolerance = 1e-3f;
+        static constexpr float AABBTolerance = 1e-3f;
+        static constexpr float SinCosTolerance = 2e-6f;
+
+        // Detects the CPU and selects the fastest supported path
+        static void Init();
+
+        static bool IsSupported(BatchMathPath path);
+        static void SetPath(BatchMathPath path); // ignored if unsupported
+        static BatchMathPath GetPath();
+        static const char* GetPathName(BatchMathPath path);
+
+        // model[i] = T * R * S
+        static void ComposeMatrices(const TransformArrays& transforms, uint32_t count, glm::mat4* outMatrices);
+        // out[i] = lhs * matrices[i], e.g. view-projection * model
+        static void MultiplyMatrices(const glm::mat4& lhs, const glm::mat4* matrices, uint32_t count, glm::mat4* outMatrices);
+        // World AABB of each local box under its matrix
+        static void TransformAABBs(const glm::mat4* matrices, const AABBArrays& local, uint32_t count, const AABBArrays& outWorld);
+        // Vectorized sin/cos (radians), max error ~1e-6 for |x| < 8192
+        static void SinCos(const float* angles, uint32_t count, float* outSin, float* outCos);
+
+        // Model matrices and unit-cube world bounds straight from the scene's Transform array,
+        // gathered into SoA in small stack blocks (no heap, any thread); outMatrices may be null
+        static void ComposeTransforms(const Transform* transforms, uint32_t count, glm::mat4* outMatrices,
+                                      glm::vec3* outMin, glm::vec3* outMax);
+
+        // Compares a path against glm on random data and measures throughput; logs an error
+        // for any kernel outside its tolerance
+        static BatchMathReport Validate(BatchMathPath path, uint32_t count = 1 << 16);
+    };
+
+}
@@ -0,0 +1,183 @@
+// Compiled with AVX2 + FMA enabled (see engine/CMakeLists.txt); only reached when
+// BatchMath::Init has confirmed the CPU supports both. Matrices are accessed as raw
+// floats so no inline glm code is instantiated here with AVX encodings.
+#include "BatchMathKernels.h"
+
+#if GROOVE_BATCHMATH_X86
+#include <immintrin.h>
+
+namespace Groove {
+namespace BatchMathKernels {
+
+    static inline void SinCos8(__m256 x, __m256& outSin, __m256& outCos) {
+        const __m256 signMask = _mm256_set1_ps(-0.0f);
+        __m256 sinSign = _mm256_and_ps(x, signMask);
+        x = _mm256_andnot_ps(signMask, x);
+
+        __m256i j = _mm256_cvttps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(FourOverPi)));
+        j = _mm256_and_si256(_mm256_add_epi32(j, _mm256_set1_epi32(1)), _mm256_set1_epi32(~1));
+        __m256 y = _mm256_cvtepi32_ps(j);
+        __m256 sinFlip = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(j, _mm256_set1_epi32(4)), 29));
+        __m256 cosFlip = _mm256_castsi256_ps(_mm256_slli_epi32(
+            _mm256_andnot_si256(_mm256_sub_epi32(j, _mm256_set1_epi32(2)), _mm256_set1_epi32(4)), 29));
+        __m256 useSinPoly = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(j, _mm256_set1_epi32(2)),
+                                                                   _mm256_setzero_si256()));
+
+        x = _mm256_fmadd_ps(y, _mm256_set1_ps(DP1), x);
+        x = _mm256_fmadd_ps(y, _mm256_set1_ps(DP2), x);
+        x = _mm256_fmadd_ps(y, _mm256_set1_ps(DP3), x);
+        __m256 z = _mm256_mul_ps(x, x);
+
+        __m256 cosPoly = _mm256_fmadd_ps(_mm256_set1_ps(CosC0), z, _mm256_set1_ps(CosC1));
+        cosPoly = _mm256_fmadd_ps(cosPoly, z, _mm256_set1_ps(CosC2));
+        cosPoly = _mm256_mul_ps(_mm256_mul_ps(cosPoly, z), z);
+        cosPoly = _mm256_add_ps(_mm256_fnmadd_ps(z, _mm256_set1_ps(0.5f), cosPoly), _mm256_set1_ps(1.0f));
+
+        __m256 sinPoly = _mm256_fmadd_ps(_mm256_set1_ps(SinC0), z, _mm256_set1_ps(SinC1));
+        sinPoly = _mm256_fmadd_ps(sinPoly, z, _mm256_set1_ps(SinC2));
+        sinPoly = _mm256_fmadd_ps(_mm256_mul_ps(sinPoly, z), x, x);
+
+        __m256 s = _mm256_blendv_ps(cosPoly, sinPoly, useSinPoly);
+        __m256 c = _mm256_blendv_ps(sinPoly, cosPoly, useSinPoly);
+        outSin = _mm256_xor_ps(s, _mm256_xor_ps(sinSign, sinFlip));
+        outCos = _mm256_xor_ps(c, cosFlip);
+    }
+
+    // Rows r0..r3 hold one matrix column for eight objects; transpose each 128-bit half
+    // and write that column into objects 0-3 and 4-7
+    static inline void StoreColumn8(float* base, int column, __m256 r0, __m256 r1, __m256 r2, __m256 r3) {
+        __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+        __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+        __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+        __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+        __m256 c0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 c1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 c2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 c3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        float* col = base + column * 4;
+        _mm_storeu_ps(col, _mm256_castps256_ps128(c0));
+        _mm_storeu_ps(col + 16, _mm256_castps256_ps128(c1));
+        _mm_storeu_ps(col + 32, _mm256_castps256_ps128(c2));
+        _mm_storeu_ps(col + 48, _mm256_castps256_ps128(c3));
+        _mm_storeu_ps(col + 64, _mm256_extractf128_ps(c0, 1));
+        _mm_storeu_ps(col + 80, _mm256_extractf128_ps(c1, 1));
+        _mm_storeu_ps(col + 96, _mm256_extractf128_ps(c2, 1));
+        _mm_storeu_ps(col + 112, _mm256_extractf128_ps(c3, 1));
+    }
+
+    static void ComposeAVX2(const TransformArrays& in, uint32_t begin, uint32_t end, glm::mat4* out) {
+        const __m256 degToRad = _mm256_set1_ps(DegToRad);
+        const __m256 zero = _mm256_setzero_ps();
+        uint32_t i = begin;
+        for (; i + 8 <= end; i += 8) {
+            __m256 sp, cp, sh, ch, sb, cb;
+            SinCos8(_mm256_mul_ps(_mm256_loadu_ps(in.RotX + i), degToRad), sp, cp);
+            SinCos8(_mm256_mul_ps(_mm256_loadu_ps(in.RotY + i), degToRad), sh, ch);
+            SinCos8(_mm256_mul_ps(_mm256_loadu_ps(in.RotZ + i), degToRad), sb, cb);
+            __m256 sx = _mm256_loadu_ps(in.ScaleX + i), sy = _mm256_loadu_ps(in.ScaleY + i), sz = _mm256_loadu_ps(in.ScaleZ + i);
+            __m256 shsp = _mm256_mul_ps(sh, sp), chsp = _mm256_mul_ps(ch, sp);
+
+            float* base = reinterpret_cast<float*>(out + i);
+            StoreColumn8(base, 0,
+                _mm256_mul_ps(_mm256_fmadd_ps(ch, cb, _mm256_mul_ps(shsp, sb)), sx),
+                _mm256_mul_ps(_mm256_mul_ps(sb, cp), sx),
+                _mm256_mul_ps(_mm256_fmsub_ps(chsp, sb, _mm256_mul_ps(sh, cb)), sx),
+                zero);
+            StoreColumn8(base, 1,
+                _mm256_mul_ps(_mm256_fmsub_ps(shsp, cb, _mm256_mul_ps(ch, sb)), sy),
+                _mm256_mul_ps(_mm256_mul_ps(cb, cp), sy),
+                _mm256_mul_ps(_mm256_fmadd_ps(sb, sh, _mm256_mul_ps(chsp, cb)), sy),
+                zero);
+            StoreColumn8(base, 2,
+                _mm256_mul_ps(_mm256_mul_ps(sh, cp), sz),
+                _mm256_mul_ps(_mm256_sub_ps(zero, sp), sz),
+                _mm256_mul_ps(_mm256_mul_ps(ch, cp), sz),
+                zero);
+            StoreColumn8(base, 3, _mm256_loadu_ps(in.PosX + i), _mm256_loadu_ps(in.PosY + i), _mm256_loadu_ps(in.PosZ + i),
+                         _mm256_set1_ps(1.0f));
+        }
+        ComposeScalar(in, i, end, out);
+    }
+
+    static void MultiplyAVX2(const glm::mat4& lhs, const glm::mat4* in, uint32_t begin, uint32_t end, glm::mat4* out) {
+        // Each lhs column duplicated into both 128-bit lanes; two result columns per iteration
+        const float* a = reinterpret_cast<const float*>(&lhs);
+        __m256 a0 = _mm256_broadcast_ps((const __m128*)a);
+        __m256 a1 = _mm256_broadcast_ps((const __m128*)(a + 4));
+        __m256 a2 = _mm256_broadcast_ps((const __m128*)(a + 8));
+        __m256 a3 = _mm256_broadcast_ps((const __m128*)(a + 12));
+        for (uint32_t i = begin; i < end; i++) {
+            const float* b = reinterpret_cast<const float*>(in + i);
+            float* r = reinterpret_cast<float*>(out + i);
+            for (int c = 0; c < 4; c += 2) {
+                __m256 cols = _mm256_loadu_ps(b + c * 4);
+                __m256 v = _mm256_mul_ps(a0, _mm256_permute_ps(cols, _MM_SHUFFLE(0, 0, 0, 0)));
+                v = _mm256_fmadd_ps(a1, _mm256_permute_ps(cols, _MM_SHUFFLE(1, 1, 1, 1)), v);
+                v = _mm256_fmadd_ps(a2, _mm256_permute_ps(cols, _MM_SHUFFLE(2, 2, 2, 2)), v);
+                v = _mm256_fmadd_ps(a3, _mm256_permute_ps(cols, _MM_SHUFFLE(3, 3, 3, 3)), v);
+                _mm256_storeu_ps(r + c * 4, v);
+            }
+        }
+    }
+
+    static void TransformAABBsAVX2(const glm::mat4* matrices, const AABBArrays& local, uint32_t begin, uint32_t end,
+                                   const AABBArrays& out) {
+        const __m256 half = _mm256_set1_ps(0.5f);
+        const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+        uint32_t i = begin;
+        for (; i + 8 <= end; i += 8) {
+            // m[c][r] for eight objects: gather column c of objects i..i+3 and i+4..i+7 into the two lanes
+            __m256 m[4][4];
+            const float* base = reinterpret_cast<const float*>(matrices + i);
+            for (int c = 0; c < 4; c++) {
+                __m256 r0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(base + c * 4)), _mm_loadu_ps(base + 64 + c * 4), 1);
+                __m256 r1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(base + 16 + c * 4)), _mm_loadu_ps(base + 80 + c * 4), 1);
+                __m256 r2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(base + 32 + c * 4)), _mm_loadu_ps(base + 96 + c * 4), 1);
+                __m256 r3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(base + 48 + c * 4)), _mm_loadu_ps(base + 112 + c * 4), 1);
+                __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+                __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+                __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+                __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+                m[c][0] = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+                m[c][1] = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+                m[c][2] = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+                m[c][3] = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+            }
+
+            __m256 minX = _mm256_loadu_ps(local.MinX + i), maxX = _mm256_loadu_ps(local.MaxX + i);
+            __m256 minY = _mm256_loadu_ps(local.MinY + i), maxY = _mm256_loadu_ps(local.MaxY + i);
+            __m256 minZ = _mm256_loadu_ps(local.MinZ + i), maxZ = _mm256_loadu_ps(local.MaxZ + i);
+            __m256 cx = _mm256_mul_ps(_mm256_add_ps(minX, maxX), half), ex = _mm256_mul_ps(_mm256_sub_ps(maxX, minX), half);
+            __m256 cy = _mm256_mul_ps(_mm256_add_ps(minY, maxY), half), ey = _mm256_mul_ps(_mm256_sub_ps(maxY, minY), half);
+            __m256 cz = _mm256_mul_ps(_mm256_add_ps(minZ, maxZ), half), ez = _mm256_mul_ps(_mm256_sub_ps(maxZ, minZ), half);
+
+            float* outMin[3] = { out.MinX, out.MinY, out.MinZ };
+            float* outMax[3] = { out.MaxX, out.MaxY, out.MaxZ };
+            for (int row = 0; row < 3; row++) {
+                __m256 center = _mm256_fmadd_ps(m[0][row], cx, _mm256_fmadd_ps(m[1][row], cy, _mm256_fmadd_ps(m[2][row], cz, m[3][row])));
+                __m256 extent = _mm256_fmadd_ps(_mm256_and_ps(m[0][row], absMask), ex,
+                                _mm256_fmadd_ps(_mm256_and_ps(m[1][row], absMask), ey,
+                                                _mm256_mul_ps(_mm256_and_ps(m[2][row], absMask), ez)));
+                _mm256_storeu_ps(outMin[row] + i, _mm256_sub_ps(center, extent));
+                _mm256_storeu_ps(outMax[row] + i, _mm256_add_ps(center, extent));
+            }
+        }
+        TransformAABBsScalar(matrices, local, i, end, out);
+    }
+
+    static void SinCosAVX2(const float* angles, uint32_t begin, uint32_t end, float* outSin, float* outCos) {
+        uint32_t i = begin;
+        for (; i + 8 <= end; i += 8) {
+            __m256 s, c;
+            SinCos8(_mm256_loadu_ps(angles + i), s, c);
+            _mm256_storeu_ps(outSin + i, s);
+            _mm256_storeu_ps(outCos + i, c);
+        }
+        SinCosScalar(angles, i, end, outSin, outCos);
+    }
+
+    const Kernels AVX2 = { ComposeAVX2, MultiplyAVX2, TransformAABBsAVX2, SinCosAVX2 };
+
+}
+}
+#endif
@@ -0,0 +1,48 @@
+#pragma once
+
+// Internal to BatchMath: one kernel table per instruction set. Each kernel handles
+// [begin, end) and finishes any remainder that does not fill a vector with scalar code.
+
+#include "BatchMath.h"
+
+#if defined(_M_X64) || defined(__SSE2__)
+#define GROOVE_BATCHMATH_X86 1
+#else
+#define GROOVE_BATCHMATH_X86 0
+#endif
+
+namespace Groove {
+namespace BatchMathKernels {
+
+    struct Kernels {
+        void (*Compose)(const TransformArrays& in, uint32_t begin, uint32_t end, glm::mat4* out);
+        void (*Multiply)(const glm::mat4& lhs, const glm::mat4* in, uint32_t begin, uint32_t end, glm::mat4* out);
+        void (*TransformAABBs)(const glm::mat4* matrices, const AABBArrays& local, uint32_t begin, uint32_t end,
+                               const AABBArrays& out);
+        void (*SinCos)(const float* angles, uint32_t begin, uint32_t end, float* outSin, float* outCos);
+    };
+
+    extern const Kernels Scalar;
+#if GROOVE_BATCHMATH_X86
+    extern const Kernels SSE;
+    extern const Kernels AVX2;
+#endif
+
+    // Scalar versions, shared as tail handlers
+    void ComposeScalar(const TransformArrays& in, uint32_t begin, uint32_t end, glm::mat4* out);
+    void MultiplyScalar(const glm::mat4& lhs, const glm::mat4* in, uint32_t begin, uint32_t end, glm::mat4* out);
+    void TransformAABBsScalar(const glm::mat4* matrices, const AABBArrays& local, uint32_t begin, uint32_t end,
+                              const AABBArrays& out);
+    void SinCosScalar(const float* angles, uint32_t begin, uint32_t end, float* outSin, float* outCos);
+
+    // Cephes single-precision sin/cos constants (range reduction by pi/4 in three parts)
+    const float FourOverPi = 1.27323954473516f;
+    const float DP1 = -0.78515625f;
+    const float DP2 = -2.4187564849853515625e-4f;
+    const float DP3 = -3.77489497744594108e-8f;
+    const float SinC0 = -1.9515295891e-4f, SinC1 = 8.3321608736e-3f, SinC2 = -1.6666654611e-1f;
+    const float CosC0 = 2.443315711809948e-5f, CosC1 = -1.388731625493765e-3f, CosC2 = 4.166664568298827e-2f;
+    const float DegToRad = 0.01745329251994329577f;
+
+}
+}
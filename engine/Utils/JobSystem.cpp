@@ -0,0 +1,134 @@
+#include "JobSystem.h"
+#include "Logger.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Groove {
+
+    // One ParallelFor call in flight; workers grab chunk indices from it until it runs dry.
+    struct ParallelBatch {
+        JobSystem::RangeFn Fn = nullptr;
+        void* Context = nullptr;
+        uint32_t Count = 0;
+        uint32_t Grain = 1;
+        uint32_t ChunkCount = 0;
+        std::atomic<uint32_t> NextChunk{ 0 };
+        std::atomic<uint32_t> DoneChunks{ 0 };
+        uint32_t Users = 0; // workers still touching this batch, guarded by s_Mutex
+    };
+
+    static std::vector<std::thread> s_Workers;
+    static std::mutex s_Mutex;
+    static std::condition_variable s_WakeCV;
+    static std::condition_variable s_DoneCV;
+    static ParallelBatch* s_Batch = nullptr;
+    static uint64_t s_BatchGeneration = 0;
+    static bool s_Running = false;
+
+    // Runs chunks of the batch until none are left
+    static void DrainBatch(ParallelBatch& batch) {
+        for (;;) {
+            uint32_t chunk = batch.NextChunk.fetch_add(1, std::memory_order_relaxed);
+            if (chunk >= batch.ChunkCount)
+                break;
+            uint32_t begin = chunk * batch.Grain;
+            uint32_t end = begin + batch.Grain < batch.Count ? begin + batch.Grain : batch.Count;
+            batch.Fn(batch.Context, begin, end);
+            batch.DoneChunks.fetch_add(1, std::memory_order_acq_rel);
+        }
+    }
+
+    static void WorkerMain() {
+        uint64_t seenGeneration = 0;
+        for (;;) {
+            ParallelBatch* batch = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(s_Mutex);
+                s_WakeCV.wait(lock, [&] { return !s_Running || (s_Batch && s_BatchGeneration != seenGeneration); });
+                if (!s_Running)
+                    return;
+                seenGeneration = s_BatchGeneration;
+                batch = s_Batch;
+                batch->Users++;
+            }
+            DrainBatch(*batch);
+            {
+                std::lock_guard<std::mutex> lock(s_Mutex);
+                batch->Users--;
+            }
+            s_DoneCV.notify_all();
+        }
+    }
+
+    void JobSystem::Init(uint32_t workerCount) {
+        if (s_Running)
+            return;
+        if (workerCount == 0) {
+            uint32_t hw = std::thread::hardware_concurrency();
+            workerCount = hw > 1 ? hw - 1 : 1;
+        }
+        s_Running = true;
+        for (uint32_t i = 0; i < workerCount; i++)
+            s_Workers.emplace_back(WorkerMain);
+        Logger::Info("JobSystem started with " + std::to_string(workerCount) + " workers.");
+    }
+
+    void JobSystem::Shutdown() {
+        {
+            std::lock_guard<std::mutex> lock(s_Mutex);
+            s_Running = false;
+        }
+        s_WakeCV.notify_all();
+        for (auto& worker : s_Workers)
+            worker.join();
+        s_Workers.clear();
+    }
+
+    void JobSystem::ParallelFor(uint32_t count, uint32_t grainSize, RangeFn fn, void* context) {
+        if (count == 0)
+            return;
+        if (grainSize == 0)
+            grainSize = 1;
+
+        // Not worth waking anyone up (or the pool is not running)
+        if (count <= grainSize || s_Workers.empty()) {
+            fn(context, 0, count);
+            return;
+        }
+
+        ParallelBatch batch;
+        batch.Fn = fn;
+        batch.Context = context;
+        batch.Count = count;
+        batch.Grain = grainSize;
+        batch.ChunkCount = (count + grainSize - 1) / grainSize;
+
+        // Only one batch is published at a time; concurrent callers queue up here.
+        // Not reentrant: fn must not call ParallelFor itself.
+        static std::mutex s_SubmitMutex;
+        std::lock_guard<std::mutex> submitLock(s_SubmitMutex);
+        {
+            std::lock_guard<std::mutex> lock(s_Mutex);
+            s_Batch = &batch;
+            s_BatchGeneration++;
+        }
+        s_WakeCV.notify_all();
+
+        DrainBatch(batch);
+
+        std::unique_lock<std::mutex> lock(s_Mutex);
+        s_DoneCV.wait(lock, [&] {
+            return batch.Users == 0 && batch.DoneChunks.load(std::memory_order_acquire) == batch.ChunkCount;
+        });
+        s_Batch = nullptr;
+    }
+
+    uint32_t JobSystem::GetWorkerCount() {
+        return (uint32_t)s_Workers.size();
+    }
+
+}
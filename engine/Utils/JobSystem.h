@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Groove {
+
+    // Small fixed pool of worker threads for data-parallel engine work
+    // (LOD selection, culling, ...). Static like Logger: Init once, Shutdown at exit.
+    class JobSystem {
+    public:
+        // workerCount == 0 picks hardware_concurrency() - 1
+        static void Init(uint32_t workerCount = 0);
+        static void Shutdown();
+
+        using RangeFn = void (*)(void* context, uint32_t begin, uint32_t end);
+
+        // Splits [0, count) into chunks of at most grainSize and runs fn(begin, end)
+        // on the workers. The calling thread helps out and returns once every chunk is done.
+        // fn is called through a plain function pointer, so no std::function allocation per call.
+        template<typename Fn>
+        static void ParallelFor(uint32_t count, uint32_t grainSize, const Fn& fn) {
+            ParallelFor(count, grainSize, &InvokeRange<Fn>, const_cast<void*>(static_cast<const void*>(&fn)));
+        }
+
+        static void ParallelFor(uint32_t count, uint32_t grainSize, RangeFn fn, void* context);
+
+        static uint32_t GetWorkerCount();
+
+    private:
+        template<typename Fn>
+        static void InvokeRange(void* context, uint32_t begin, uint32_t end) {
+            (*static_cast<const Fn*>(context))(begin, end);
+        }
+    };
+
+}
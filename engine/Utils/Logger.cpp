@@ -1,4 +1,5 @@
 #include "Logger.h"
+#include "MemoryTracker.h"
 #include <iostream>
 #include <fstream>
 #include <windows.h>
@@ -12,6 +13,7 @@ namespace Groove {
     static bool s_LogToFile = false;
 
     void Logger::Init(const std::string& logFilePath) {
+        MemoryTagScope memTag(MemTag::Logger);
         if (!logFilePath.empty()) {
             s_LogFile.open(logFilePath, std::ios::out | std::ios::trunc);
             s_LogToFile = s_LogFile.is_open();
@@ -25,22 +27,38 @@ namespace Groove {
     }
 
     void Logger::Info(const std::string& message) {
+        Log(message.c_str(), LogLevel::Info);
+    }
+
+    void Logger::Info(const char* message) {
         Log(message, LogLevel::Info);
     }
 
     void Logger::Warning(const std::string& message) {
+        Log(message.c_str(), LogLevel::Warning);
+    }
+
+    void Logger::Warning(const char* message) {
         Log(message, LogLevel::Warning);
     }
 
     void Logger::Error(const std::string& message) {
+        Log(message.c_str(), LogLevel::Error);
+    }
+
+    void Logger::Error(const char* message) {
         Log(message, LogLevel::Error);
     }
 
     void Logger::Debug(const std::string& message) {
+        Log(message.c_str(), LogLevel::Debug);
+    }
+
+    void Logger::Debug(const char* message) {
         Log(message, LogLevel::Debug);
     }
 
-    void Logger::Log(const std::string& message, LogLevel level) {
+    void Logger::Log(const char* message, LogLevel level) {
         HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
 
         switch (level) {
@@ -20,9 +20,15 @@ namespace Groove {
         static void Error(const std::string& message);
         static void Debug(const std::string& message);
 
+        // Allocation-free overloads for per-frame logging (e.g. with LinearArena::Format)
+        static void Info(const char* message);
+        static void Warning(const char* message);
+        static void Error(const char* message);
+        static void Debug(const char* message);
+
         static void Shutdown();
 
     private:
-        static void Log(const std::string& message, LogLevel level);
+        static void Log(const char* message, LogLevel level);
     };
 }
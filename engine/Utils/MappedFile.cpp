@@ -0,0 +1,100 @@
+#include "MappedFile.h"
+#include "Logger.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Groove {
+
+    MappedFile::~MappedFile() {
+        Close();
+    }
+
+#ifdef _WIN32
+    bool MappedFile::Open(const char* path) {
+        Close();
+        HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            Logger::Error("MappedFile: could not open file");
+            return false;
+        }
+        LARGE_INTEGER size;
+        GetFileSizeEx(file, &size);
+        if (size.QuadPart == 0) {
+            CloseHandle(file);
+            Logger::Error("MappedFile: file is empty");
+            return false;
+        }
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (!view) {
+            if (mapping)
+                CloseHandle(mapping);
+            CloseHandle(file);
+            Logger::Error("MappedFile: could not map file");
+            return false;
+        }
+        m_File = file;
+        m_Mapping = mapping;
+        m_Data = static_cast<const uint8_t*>(view);
+        m_Size = (size_t)size.QuadPart;
+        return true;
+    }
+
+    void MappedFile::Close() {
+        if (m_Data)
+            UnmapViewOfFile(m_Data);
+        if (m_Mapping)
+            CloseHandle(m_Mapping);
+        if (m_File)
+            CloseHandle(m_File);
+        m_Data = nullptr;
+        m_Mapping = nullptr;
+        m_File = nullptr;
+        m_Size = 0;
+    }
+#else
+    bool MappedFile::Open(const char* path) {
+        Close();
+        int file = open(path, O_RDONLY);
+        if (file < 0) {
+            Logger::Error("MappedFile: could not open file");
+            return false;
+        }
+        struct stat info;
+        if (fstat(file, &info) != 0 || info.st_size == 0) {
+            close(file);
+            Logger::Error("MappedFile: file is empty");
+            return false;
+        }
+        void* view = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (view == MAP_FAILED) {
+            close(file);
+            Logger::Error("MappedFile: could not map file");
+            return false;
+        }
+        m_File = file;
+        m_Data = static_cast<const uint8_t*>(view);
+        m_Size = (size_t)info.st_size;
+        return true;
+    }
+
+    void MappedFile::Close() {
+        if (m_Data)
+            munmap(const_cast<uint8_t*>(m_Data), m_Size);
+        if (m_File >= 0)
+            close(m_File);
+        m_Data = nullptr;
+        m_File = -1;
+        m_Size = 0;
+    }
+#endif
+
+}
@@ -0,0 +1,173 @@
+#include "Memory.h"
+#include "MemoryTracker.h"
+
+#include <atomic>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace Groove {
+
+    static size_t AlignUp(size_t value, size_t alignment) {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    LinearArena::LinearArena(size_t capacity)
+        : m_Capacity(capacity) {
+        m_Base = static_cast<uint8_t*>(::operator new(capacity));
+    }
+
+    LinearArena::~LinearArena() {
+        Reset();
+        ::operator delete(m_Base);
+    }
+
+    void* LinearArena::Allocate(size_t size, size_t alignment) {
+        size_t offset = AlignUp((size_t)(m_Base + m_Used), alignment) - (size_t)m_Base;
+        if (offset + size <= m_Capacity) {
+            m_Used = offset + size;
+            return m_Base + offset;
+        }
+
+        // Out of room this frame: chain an overflow block rather than failing
+        size_t blockSize = AlignUp(sizeof(Overflow), alignof(std::max_align_t)) + size + alignment;
+        Overflow* block = static_cast<Overflow*>(::operator new(blockSize));
+        block->Next = m_Overflow;
+        block->Size = blockSize;
+        m_Overflow = block;
+        m_OverflowUsed += size;
+
+        uint8_t* data = reinterpret_cast<uint8_t*>(block) + AlignUp(sizeof(Overflow), alignof(std::max_align_t));
+        return reinterpret_cast<void*>(AlignUp((size_t)data, alignment));
+    }
+
+    void LinearArena::Reset() {
+        size_t used = GetUsed();
+        if (used > m_HighWater)
+            m_HighWater = used;
+
+        bool overflowed = m_Overflow != nullptr;
+        while (m_Overflow) {
+            Overflow* next = m_Overflow->Next;
+            ::operator delete(m_Overflow);
+            m_Overflow = next;
+        }
+
+        // Grow once so the same workload fits in a single block next frame
+        if (overflowed) {
+            ::operator delete(m_Base);
+            m_Capacity = AlignUp(m_HighWater + m_HighWater / 4, 4096);
+            m_Base = static_cast<uint8_t*>(::operator new(m_Capacity));
+        }
+
+        m_Used = 0;
+        m_OverflowUsed = 0;
+    }
+
+    const char* LinearArena::Format(const char* fmt, ...) {
+        va_list args;
+        va_start(args, fmt);
+        va_list argsCopy;
+        va_copy(argsCopy, args);
+        int length = std::vsnprintf(nullptr, 0, fmt, argsCopy);
+        va_end(argsCopy);
+
+        if (length < 0) {
+            va_end(args);
+            return "";
+        }
+        char* buffer = static_cast<char*>(Allocate((size_t)length + 1, 1));
+        std::vsnprintf(buffer, (size_t)length + 1, fmt, args);
+        va_end(args);
+        return buffer;
+    }
+
+    namespace Memory {
+
+        static std::atomic<uint64_t> s_AllocationCount{ 0 };
+
+        LinearArena& GetFrameArena() {
+            static LinearArena s_FrameArena(1024 * 1024);
+            return s_FrameArena;
+        }
+
+        void EndFrame() {
+            GetFrameArena().Reset();
+        }
+
+        uint64_t GetAllocationCount() {
+            return s_AllocationCount.load(std::memory_order_relaxed);
+        }
+
+        static void CountAllocation() {
+            s_AllocationCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+    }
+
+}
+
+// Global operator new replacement so steady-state frames can be checked for heap traffic.
+// The array, nothrow and sized-delete forms all funnel through these two; the aligned forms
+// over-allocate through them and keep the original pointer just below the aligned block.
+// Each block carries its size and MemTag in a header (MemoryTracker::TaggedAlloc uses the same
+// layout); 16 bytes keeps the returned pointer max_align_t aligned.
+void* operator new(size_t size) {
+    Groove::Memory::CountAllocation();
+    void* p = Groove::MemoryTracker::TaggedAlloc(size, Groove::MemoryTracker::GetCurrentTag());
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    Groove::MemoryTracker::TaggedFree(p);
+}
+
+void* operator new[](size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete[](void* p) noexcept {
+    ::operator delete(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    ::operator delete(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+    ::operator delete(p);
+}
+
+#ifdef __cpp_aligned_new
+void* operator new(size_t size, std::align_val_t alignment) {
+    size_t align = (size_t)alignment;
+    void* raw = ::operator new(size + align + sizeof(void*));
+    uintptr_t aligned = ((uintptr_t)raw + sizeof(void*) + align - 1) & ~(uintptr_t)(align - 1);
+    reinterpret_cast<void**>(aligned)[-1] = raw;
+    return reinterpret_cast<void*>(aligned);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+    if (p)
+        ::operator delete(reinterpret_cast<void**>(p)[-1]);
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+    return ::operator new(size, alignment);
+}
+
+void operator delete[](void* p, std::align_val_t alignment) noexcept {
+    ::operator delete(p, alignment);
+}
+
+void operator delete(void* p, size_t, std::align_val_t alignment) noexcept {
+    ::operator delete(p, alignment);
+}
+
+void operator delete[](void* p, size_t, std::align_val_t alignment) noexcept {
+    ::operator delete(p, alignment);
+}
+#endif
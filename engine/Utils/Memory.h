@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace Groove {
+
+    // Bump allocator: Allocate is a pointer increment, Reset frees everything at once.
+    // If a frame outgrows the block, extra blocks are chained and the next Reset grows
+    // the main block to the high-water mark, so steady-state frames never hit the heap.
+    class LinearArena {
+    public:
+        explicit LinearArena(size_t capacity);
+        ~LinearArena();
+
+        LinearArena(const LinearArena&) = delete;
+        LinearArena& operator=(const LinearArena&) = delete;
+
+        void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+        void  Reset();
+
+        // printf into arena memory; the string lives until the next Reset
+        const char* Format(const char* fmt, ...);
+
+        size_t GetUsed() const { return m_Used + m_OverflowUsed; }
+        size_t GetCapacity() const { return m_Capacity; }
+        size_t GetHighWater() const { return m_HighWater; }
+
+    private:
+        struct Overflow {
+            Overflow* Next;
+            size_t    Size;
+        };
+
+        uint8_t*  m_Base = nullptr;
+        size_t    m_Capacity = 0;
+        size_t    m_Used = 0;
+        Overflow* m_Overflow = nullptr;
+        size_t    m_OverflowUsed = 0;
+        size_t    m_HighWater = 0;
+    };
+
+    // STL allocator over a LinearArena; deallocate is a no-op (memory goes back on Reset)
+    template<typename T>
+    class ArenaAllocator {
+    public:
+        using value_type = T;
+
+        ArenaAllocator(LinearArena& arena) : m_Arena(&arena) {}
+        template<typename U>
+        ArenaAllocator(const ArenaAllocator<U>& other) : m_Arena(other.GetArena()) {}
+
+        T* allocate(size_t n) { return static_cast<T*>(m_Arena->Allocate(n * sizeof(T), alignof(T))); }
+        void deallocate(T*, size_t) {}
+
+        LinearArena* GetArena() const { return m_Arena; }
+
+        template<typename U>
+        bool operator==(const ArenaAllocator<U>& other) const { return m_Arena == other.GetArena(); }
+        template<typename U>
+        bool operator!=(const ArenaAllocator<U>& other) const { return m_Arena != other.GetArena(); }
+
+    private:
+        LinearArena* m_Arena;
+    };
+
+    // Arena-backed containers for temporaries that die with the frame
+    template<typename T>
+    using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+    // Fixed-size object pool for components, draw packets and other churny objects.
+    // Slots are carved out of chunks of ChunkCapacity and recycled through a free list;
+    // chunks are only returned to the heap when the pool is destroyed.
+    template<typename T, size_t ChunkCapacity = 256>
+    class ObjectPool {
+    public:
+        ObjectPool() = default;
+        ~ObjectPool() {
+            for (Slot* chunk : m_Chunks)
+                ::operator delete(chunk);
+        }
+
+        ObjectPool(const ObjectPool&) = delete;
+        ObjectPool& operator=(const ObjectPool&) = delete;
+
+        template<typename... Args>
+        T* New(Args&&... args) {
+            if (!m_FreeList)
+                Grow();
+            Slot* slot = m_FreeList;
+            m_FreeList = slot->Next;
+            m_Live++;
+            return new (slot->Storage) T(std::forward<Args>(args)...);
+        }
+
+        void Delete(T* object) {
+            if (!object)
+                return;
+            object->~T();
+            Slot* slot = reinterpret_cast<Slot*>(object);
+            slot->Next = m_FreeList;
+            m_FreeList = slot;
+            m_Live--;
+        }
+
+        // Pre-allocate so the first frames do not grow the pool mid-frame
+        void Reserve(size_t count) {
+            while (m_Chunks.size() * ChunkCapacity < count)
+                Grow();
+        }
+
+        size_t GetLiveCount() const { return m_Live; }
+        size_t GetCapacity() const { return m_Chunks.size() * ChunkCapacity; }
+
+    private:
+        union Slot {
+            Slot* Next;
+            alignas(T) unsigned char Storage[sizeof(T)];
+        };
+
+        void Grow() {
+            Slot* chunk = static_cast<Slot*>(::operator new(sizeof(Slot) * ChunkCapacity));
+            m_Chunks.push_back(chunk);
+            for (size_t i = ChunkCapacity; i-- > 0;) {
+                chunk[i].Next = m_FreeList;
+                m_FreeList = &chunk[i];
+            }
+        }
+
+        std::vector<Slot*> m_Chunks;
+        Slot* m_FreeList = nullptr;
+        size_t m_Live = 0;
+    };
+
+    namespace Memory {
+
+        // Per-frame scratch arena (main thread only), reset by EndFrame
+        LinearArena& GetFrameArena();
+        void EndFrame();
+
+        // Number of global operator new calls since startup (all threads)
+        uint64_t GetAllocationCount();
+
+    }
+
+}
@@ -0,0 +1,175 @@
+#include "MemoryTracker.h"
+#include "Logger.h"
+#include "Memory.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+
+namespace Groove {
+
+    static const size_t TagCount = (size_t)MemTag::Count;
+
+    // Plain atomics so the allocator hooks work during static initialisation
+    struct TagCounters {
+        std::atomic<int64_t>  CpuBytes;
+        std::atomic<int64_t>  CpuPeak;
+        std::atomic<int64_t>  CpuLive;
+        std::atomic<uint64_t> FrameAllocs;
+        std::atomic<uint64_t> FrameFrees;
+        std::atomic<uint64_t> FrameBytes;
+        std::atomic<int64_t>  GpuBytes;
+        std::atomic<int64_t>  GpuPeak;
+    };
+
+    static TagCounters s_Counters[TagCount];
+
+    // Main-thread only state
+    static MemoryTagStats s_LastFrame[TagCount];
+    static int64_t s_Budgets[TagCount];
+    static bool s_OverBudget[TagCount];
+    static FILE* s_DumpFile = nullptr;
+    static float s_DumpInterval = 0.0f;
+    static double s_LastDumpTime = 0.0;
+
+    static thread_local MemTag t_CurrentTag = MemTag::Core;
+
+    static void UpdatePeak(std::atomic<int64_t>& peak, int64_t value) {
+        int64_t current = peak.load(std::memory_order_relaxed);
+        while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+    }
+
+    const char* MemoryTracker::GetTagName(MemTag tag) {
+        switch (tag) {
+            case MemTag::Core:     return "Core";
+            case MemTag::Renderer: return "Renderer";
+            case MemTag::Logger:   return "Logger";
+            case MemTag::ImGui:    return "ImGui";
+            case MemTag::Scene:    return "Scene";
+            case MemTag::Physics:  return "Physics";
+            default:               return "Unknown";
+        }
+    }
+
+    MemTag MemoryTracker::GetCurrentTag() {
+        return t_CurrentTag;
+    }
+
+    void MemoryTracker::SetCurrentTag(MemTag tag) {
+        t_CurrentTag = tag;
+    }
+
+    void MemoryTracker::RecordCpuAlloc(MemTag tag, size_t bytes) {
+        TagCounters& c = s_Counters[(size_t)tag];
+        int64_t total = c.CpuBytes.fetch_add((int64_t)bytes, std::memory_order_relaxed) + (int64_t)bytes;
+        UpdatePeak(c.CpuPeak, total);
+        c.CpuLive.fetch_add(1, std::memory_order_relaxed);
+        c.FrameAllocs.fetch_add(1, std::memory_order_relaxed);
+        c.FrameBytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    void MemoryTracker::RecordCpuFree(MemTag tag, size_t bytes) {
+        TagCounters& c = s_Counters[(size_t)tag];
+        c.CpuBytes.fetch_sub((int64_t)bytes, std::memory_order_relaxed);
+        c.CpuLive.fetch_sub(1, std::memory_order_relaxed);
+        c.FrameFrees.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void MemoryTracker::TrackGpuAlloc(MemTag tag, int64_t bytes) {
+        TagCounters& c = s_Counters[(size_t)tag];
+        int64_t total = c.GpuBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        UpdatePeak(c.GpuPeak, total);
+    }
+
+    void MemoryTracker::TrackGpuFree(MemTag tag, int64_t bytes) {
+        s_Counters[(size_t)tag].GpuBytes.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    void MemoryTracker::SetBudget(MemTag tag, int64_t bytes) {
+        s_Budgets[(size_t)tag] = bytes;
+        s_OverBudget[(size_t)tag] = false;
+    }
+
+    void MemoryTracker::SetDumpFile(const char* path, float intervalSeconds) {
+        if (s_DumpFile) {
+            std::fclose(s_DumpFile);
+            s_DumpFile = nullptr;
+        }
+        s_DumpInterval = intervalSeconds;
+        if (path && intervalSeconds > 0.0f) {
+            s_DumpFile = std::fopen(path, "w");
+            if (!s_DumpFile) {
+                Logger::Error("MemoryTracker: could not open dump file");
+                return;
+            }
+            std::fprintf(s_DumpFile, "time,tag,cpu_bytes,cpu_peak,cpu_live_allocs,allocs_frame,frees_frame,bytes_alloc_frame,gpu_bytes,gpu_peak,budget\n");
+        }
+    }
+
+    void MemoryTracker::EndFrame(double timeSeconds) {
+        for (size_t i = 0; i < TagCount; i++) {
+            TagCounters& c = s_Counters[i];
+            MemoryTagStats& s = s_LastFrame[i];
+            s.CpuBytes = c.CpuBytes.load(std::memory_order_relaxed);
+            s.CpuPeak = c.CpuPeak.load(std::memory_order_relaxed);
+            s.CpuLiveAllocations = c.CpuLive.load(std::memory_order_relaxed);
+            s.AllocsLastFrame = c.FrameAllocs.exchange(0, std::memory_order_relaxed);
+            s.FreesLastFrame = c.FrameFrees.exchange(0, std::memory_order_relaxed);
+            s.BytesAllocatedLastFrame = c.FrameBytes.exchange(0, std::memory_order_relaxed);
+            s.GpuBytes = c.GpuBytes.load(std::memory_order_relaxed);
+            s.GpuPeak = c.GpuPeak.load(std::memory_order_relaxed);
+            s.Budget = s_Budgets[i];
+
+            // Warn when crossing the budget, re-arm once back under it
+            bool over = s.Budget > 0 && s.CpuBytes + s.GpuBytes > s.Budget;
+            if (over && !s_OverBudget[i]) {
+                Logger::Warning(Memory::GetFrameArena().Format("Memory budget exceeded for %s: %lld / %lld bytes",
+                    GetTagName((MemTag)i), (long long)(s.CpuBytes + s.GpuBytes), (long long)s.Budget));
+            }
+            s_OverBudget[i] = over;
+        }
+
+        if (s_DumpFile && timeSeconds - s_LastDumpTime >= s_DumpInterval) {
+            s_LastDumpTime = timeSeconds;
+            for (size_t i = 0; i < TagCount; i++) {
+                const MemoryTagStats& s = s_LastFrame[i];
+                std::fprintf(s_DumpFile, "%.3f,%s,%lld,%lld,%lld,%llu,%llu,%llu,%lld,%lld,%lld\n",
+                    timeSeconds, GetTagName((MemTag)i),
+                    (long long)s.CpuBytes, (long long)s.CpuPeak, (long long)s.CpuLiveAllocations,
+                    (unsigned long long)s.AllocsLastFrame, (unsigned long long)s.FreesLastFrame,
+                    (unsigned long long)s.BytesAllocatedLastFrame,
+                    (long long)s.GpuBytes, (long long)s.GpuPeak, (long long)s.Budget);
+            }
+            std::fflush(s_DumpFile);
+        }
+    }
+
+    MemoryTagStats MemoryTracker::GetStats(MemTag tag) {
+        return s_LastFrame[(size_t)tag];
+    }
+
+    // Same 16-byte header layout as the operator new hooks, so both paths account identically
+    struct TaggedHeader {
+        uint64_t Size;
+        uint64_t Tag;
+    };
+
+    void* MemoryTracker::TaggedAlloc(size_t size, MemTag tag) {
+        TaggedHeader* header = static_cast<TaggedHeader*>(std::malloc(sizeof(TaggedHeader) + size));
+        if (!header)
+            return nullptr;
+        header->Size = size;
+        header->Tag = (uint64_t)tag;
+        RecordCpuAlloc(tag, size);
+        return header + 1;
+    }
+
+    void MemoryTracker::TaggedFree(void* p) {
+        if (!p)
+            return;
+        TaggedHeader* header = static_cast<TaggedHeader*>(p) - 1;
+        RecordCpuFree((MemTag)header->Tag, (size_t)header->Size);
+        std::free(header);
+    }
+
+}
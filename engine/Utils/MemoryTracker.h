@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Groove {
+
+    // Subsystem an allocation is charged to. Core is the default for untagged code.
+    enum class MemTag : uint8_t {
+        Core = 0,
+        Renderer,
+        Logger,
+        ImGui,
+        Scene,
+        Physics,
+        Count
+    };
+
+    struct MemoryTagStats {
+        int64_t  CpuBytes = 0;
+        int64_t  CpuPeak = 0;
+        int64_t  CpuLiveAllocations = 0;     // outstanding blocks (growing count + flat bytes = fragmentation)
+        uint64_t AllocsLastFrame = 0;
+        uint64_t FreesLastFrame = 0;
+        uint64_t BytesAllocatedLastFrame = 0;
+        int64_t  GpuBytes = 0;               // GL buffers / textures / renderbuffers
+        int64_t  GpuPeak = 0;
+        int64_t  Budget = 0;                 // CPU + GPU; 0 = no budget
+    };
+
+    // Running totals, peaks and per-frame churn per MemTag. CPU allocations are charged by the
+    // global operator new (see Memory.cpp) to the calling thread's current tag; GL objects are
+    // reported explicitly with TrackGpuAlloc / TrackGpuFree where they are created.
+    class MemoryTracker {
+    public:
+        static const char* GetTagName(MemTag tag);
+
+        static MemTag GetCurrentTag();
+        static void   SetCurrentTag(MemTag tag);
+
+        // Called by the allocator hooks
+        static void RecordCpuAlloc(MemTag tag, size_t bytes);
+        static void RecordCpuFree(MemTag tag, size_t bytes);
+
+        static void TrackGpuAlloc(MemTag tag, int64_t bytes);
+        static void TrackGpuFree(MemTag tag, int64_t bytes);
+
+        // Warn (once per crossing) when a tag's CPU + GPU total goes over its budget
+        static void SetBudget(MemTag tag, int64_t bytes);
+
+        // Periodic dump of every tag to a text file; interval 0 disables it
+        static void SetDumpFile(const char* path, float intervalSeconds);
+
+        // Rolls per-frame churn into the "last frame" stats, checks budgets, writes dumps
+        static void EndFrame(double timeSeconds);
+
+        static MemoryTagStats GetStats(MemTag tag);
+
+        // Malloc-style entry points for C libraries with allocator hooks (ImGui)
+        static void* TaggedAlloc(size_t size, MemTag tag);
+        static void  TaggedFree(void* p);
+    };
+
+    // Charges every allocation made on this thread in the enclosing scope to a tag
+    class MemoryTagScope {
+    public:
+        explicit MemoryTagScope(MemTag tag) : m_Previous(MemoryTracker::GetCurrentTag()) { MemoryTracker::SetCurrentTag(tag); }
+        ~MemoryTagScope() { MemoryTracker::SetCurrentTag(m_Previous); }
+
+        MemoryTagScope(const MemoryTagScope&) = delete;
+        MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+    private:
+        MemTag m_Previous;
+    };
+
+}
@@ -0,0 +1,354 @@
+#include "Metrics.h"
+#include "Logger.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace Groove {
+
+    // Per-thread value slots: 1 per counter, bounds + 2 per histogram (buckets, +Inf, sum)
+    static const uint32_t MaxShardValues = 1024;
+
+    struct MetricDef {
+        char        Name[MetricsNameSize];
+        std::string Help;
+        MetricType  Type = MetricType::Counter;
+        uint32_t    BoundCount = 0;
+        double      Bounds[MetricsMaxBuckets] = {};
+        uint32_t    FirstValue = 0;
+    };
+
+    // Written only by the owning thread (load + store, no locked RMW); Publish reads them relaxed
+    struct Shard {
+        std::atomic<uint64_t> Values[MaxShardValues];
+        Shard* Next = nullptr;
+    };
+
+    // Main-thread state: definitions are complete before an id is handed out
+    static MetricDef s_Defs[MetricsMaxEntries];
+    static uint32_t s_MetricCount = 0;
+    static uint32_t s_ValueCount = 0;
+
+    static std::atomic<uint64_t> s_Gauges[MetricsMaxEntries];
+    static std::atomic<Shard*> s_Shards(nullptr);
+    static thread_local Shard* t_Shard = nullptr;
+
+    static MetricsSegment* s_Segment = nullptr;
+#ifdef _WIN32
+    static HANDLE s_Mapping = nullptr;
+#endif
+    static MetricsEntry s_Snapshot[MetricsMaxEntries];
+    static uint64_t s_PublishCount = 0;
+
+    static std::string s_PromPath, s_PromTempPath;
+    static float s_PromInterval = 0.0f;
+    static double s_LastPromTime = 0.0;
+
+    static uint64_t ToBits(double value) {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    static double FromBits(uint64_t bits) {
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    static Shard* GetShard() {
+        if (t_Shard)
+            return t_Shard;
+        Shard* shard = new Shard();
+        for (std::atomic<uint64_t>& value : shard->Values)
+            value.store(0, std::memory_order_relaxed);
+        // Push onto the lock-free list Publish walks; shards live until Shutdown
+        Shard* head = s_Shards.load(std::memory_order_relaxed);
+        do {
+            shard->Next = head;
+        } while (!s_Shards.compare_exchange_weak(head, shard, std::memory_order_release, std::memory_order_relaxed));
+        t_Shard = shard;
+        return shard;
+    }
+
+    static void AddToSlot(Shard* shard, uint32_t slot, uint64_t delta) {
+        std::atomic<uint64_t>& value = shard->Values[slot];
+        value.store(value.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    static MetricId Register(const char* name, const char* help, MetricType type, const double* bounds, uint32_t boundCount) {
+        uint32_t slots = type == MetricType::Counter ? 1 : type == MetricType::Histogram ? boundCount + 2 : 0;
+        if (s_MetricCount == MetricsMaxEntries || s_ValueCount + slots > MaxShardValues ||
+            boundCount > MetricsMaxBuckets || std::strlen(name) >= MetricsNameSize) {
+            Logger::Error(std::string("Metrics: cannot register ") + name);
+            return InvalidMetric;
+        }
+
+        MetricDef& def = s_Defs[s_MetricCount];
+        std::strncpy(def.Name, name, MetricsNameSize - 1);
+        def.Name[MetricsNameSize - 1] = '\0';
+        def.Help = help ? help : "";
+        def.Type = type;
+        def.BoundCount = boundCount;
+        for (uint32_t i = 0; i < boundCount; i++)
+            def.Bounds[i] = bounds[i];
+        def.FirstValue = s_ValueCount;
+        s_ValueCount += slots;
+        s_Gauges[s_MetricCount].store(ToBits(0.0), std::memory_order_relaxed);
+        return s_MetricCount++;
+    }
+
+    bool Metrics::Init() {
+        const size_t size = sizeof(MetricsSegment);
+#ifdef _WIN32
+        s_Mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, (DWORD)size, MetricsSegmentName);
+        void* view = s_Mapping ? MapViewOfFile(s_Mapping, FILE_MAP_ALL_ACCESS, 0, 0, size) : nullptr;
+        if (!view) {
+            if (s_Mapping)
+                CloseHandle(s_Mapping);
+            s_Mapping = nullptr;
+            Logger::Error("Metrics: could not create shared memory segment");
+            return false;
+        }
+#else
+        int fd = shm_open(MetricsSegmentName, O_CREAT | O_RDWR, 0644);
+        if (fd < 0) {
+            Logger::Error("Metrics: could not create shared memory segment");
+            return false;
+        }
+        void* view = ftruncate(fd, (off_t)size) == 0
+            ? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+        close(fd);
+        if (view == MAP_FAILED) {
+            shm_unlink(MetricsSegmentName);
+            Logger::Error("Metrics: could not map shared memory segment");
+            return false;
+        }
+#endif
+        // A segment left by a crashed run may hold an odd sequence; readers wait for the magic
+        s_Segment = static_cast<MetricsSegment*>(view);
+        s_Segment->Magic = 0;
+        s_Segment->Version = MetricsVersion;
+        s_Segment->EntryCount = 0;
+        s_Segment->PublishCount = 0;
+#ifdef _WIN32
+        s_Segment->ProcessId = (int64_t)GetCurrentProcessId();
+#else
+        s_Segment->ProcessId = (int64_t)getpid();
+#endif
+        s_Segment->Sequence.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        s_Segment->Magic = MetricsMagic;
+
+        Logger::Info(std::string("Metrics: publishing to shared memory ") + MetricsSegmentName);
+        return true;
+    }
+
+    void Metrics::Shutdown() {
+        if (s_Segment) {
+#ifdef _WIN32
+            UnmapViewOfFile(s_Segment);
+            CloseHandle(s_Mapping);
+            s_Mapping = nullptr;
+#else
+            munmap(s_Segment, sizeof(MetricsSegment));
+            shm_unlink(MetricsSegmentName);
+#endif
+            s_Segment = nullptr;
+        }
+        SetPrometheusFile(nullptr, 0.0f);
+
+        // Worker threads have stopped by now; the main thread gets a fresh shard if it records again
+        Shard* shard = s_Shards.exchange(nullptr, std::memory_order_acquire);
+        while (shard) {
+            Shard* next = shard->Next;
+            delete shard;
+            shard = next;
+        }
+        t_Shard = nullptr;
+    }
+
+    MetricId Metrics::RegisterCounter(const char* name, const char* help) {
+        return Register(name, help, MetricType::Counter, nullptr, 0);
+    }
+
+    MetricId Metrics::RegisterGauge(const char* name, const char* help) {
+        return Register(name, help, MetricType::Gauge, nullptr, 0);
+    }
+
+    MetricId Metrics::RegisterHistogram(const char* name, const char* help, const double* bounds, uint32_t boundCount) {
+        return Register(name, help, MetricType::Histogram, bounds, boundCount);
+    }
+
+    void Metrics::Increment(MetricId id, uint64_t delta) {
+        if (id == InvalidMetric)
+            return;
+        AddToSlot(GetShard(), s_Defs[id].FirstValue, delta);
+    }
+
+    void Metrics::SetGauge(MetricId id, double value) {
+        if (id == InvalidMetric)
+            return;
+        s_Gauges[id].store(ToBits(value), std::memory_order_relaxed);
+    }
+
+    void Metrics::Observe(MetricId id, double value) {
+        if (id == InvalidMetric)
+            return;
+        const MetricDef& def = s_Defs[id];
+        uint32_t bucket = 0;
+        while (bucket < def.BoundCount && value > def.Bounds[bucket])
+            bucket++;
+
+        Shard* shard = GetShard();
+        AddToSlot(shard, def.FirstValue + bucket, 1);
+        std::atomic<uint64_t>& sum = shard->Values[def.FirstValue + def.BoundCount + 1];
+        sum.store(ToBits(FromBits(sum.load(std::memory_order_relaxed)) + value), std::memory_order_relaxed);
+    }
+
+    void Metrics::SetPrometheusFile(const char* path, float intervalSeconds) {
+        s_PromInterval = path ? intervalSeconds : 0.0f;
+        s_PromPath = path ? path : "";
+        s_PromTempPath = path ? s_PromPath + ".tmp" : "";
+        s_LastPromTime = 0.0;
+    }
+
+    uint32_t Metrics::GetMetricCount() {
+        return s_MetricCount;
+    }
+
+    // Splits name{labels} into the family length and the label text without braces
+    static void SplitName(const char* name, int& familyLength, const char*& labels, int& labelsLength) {
+        const char* brace = std::strchr(name, '{');
+        familyLength = brace ? (int)(brace - name) : (int)std::strlen(name);
+        labels = brace ? brace + 1 : "";
+        labelsLength = brace ? (int)std::strlen(labels) - 1 : 0;
+    }
+
+    static void WritePrometheus() {
+        FILE* file = std::fopen(s_PromTempPath.c_str(), "w");
+        if (!file) {
+            Logger::Error("Metrics: could not open Prometheus textfile");
+            s_PromInterval = 0.0f;
+            return;
+        }
+
+        static const char* typeNames[] = { "counter", "gauge", "histogram" };
+        const char* previousFamily = "";
+        int previousLength = -1;
+        for (uint32_t i = 0; i < s_MetricCount; i++) {
+            const MetricDef& def = s_Defs[i];
+            const MetricsEntry& entry = s_Snapshot[i];
+            int familyLength, labelsLength;
+            const char* labels;
+            SplitName(def.Name, familyLength, labels, labelsLength);
+
+            // One HELP/TYPE block per family; labelled series follow it
+            if (familyLength != previousLength || std::strncmp(def.Name, previousFamily, familyLength) != 0) {
+                if (!def.Help.empty())
+                    std::fprintf(file, "# HELP %.*s %s\n", familyLength, def.Name, def.Help.c_str());
+                std::fprintf(file, "# TYPE %.*s %s\n", familyLength, def.Name, typeNames[(int)def.Type]);
+                previousFamily = def.Name;
+                previousLength = familyLength;
+            }
+
+            if (def.Type != MetricType::Histogram) {
+                std::fprintf(file, "%s %.10g\n", def.Name, entry.Value);
+                continue;
+            }
+            const char* separator = labelsLength > 0 ? "," : "";
+            for (uint32_t b = 0; b < def.BoundCount; b++)
+                std::fprintf(file, "%.*s_bucket{%.*s%sle=\"%g\"} %llu\n", familyLength, def.Name, labelsLength, labels,
+                             separator, def.Bounds[b], (unsigned long long)entry.Buckets[b]);
+            std::fprintf(file, "%.*s_bucket{%.*s%sle=\"+Inf\"} %llu\n", familyLength, def.Name, labelsLength, labels,
+                         separator, (unsigned long long)entry.Count);
+            const char* open = labelsLength > 0 ? "{" : "";
+            const char* close = labelsLength > 0 ? "}" : "";
+            std::fprintf(file, "%.*s_sum%s%.*s%s %.10g\n", familyLength, def.Name, open, labelsLength, labels, close, entry.Sum);
+            std::fprintf(file, "%.*s_count%s%.*s%s %llu\n", familyLength, def.Name, open, labelsLength, labels, close,
+                         (unsigned long long)entry.Count);
+        }
+        std::fclose(file);
+
+        // Collectors must never see a half-written or missing file: replace it in one step
+        // (rename already overwrites atomically on POSIX, Windows needs MoveFileEx for that)
+#ifdef _WIN32
+        bool replaced = MoveFileExA(s_PromTempPath.c_str(), s_PromPath.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+        bool replaced = std::rename(s_PromTempPath.c_str(), s_PromPath.c_str()) == 0;
+#endif
+        if (!replaced)
+            Logger::Error("Metrics: could not replace Prometheus textfile");
+    }
+
+    void Metrics::Publish(double timeSeconds) {
+        bool writeProm = s_PromInterval > 0.0f && timeSeconds - s_LastPromTime >= s_PromInterval;
+        if (!s_Segment && !writeProm)
+            return;
+
+        Shard* head = s_Shards.load(std::memory_order_acquire);
+        for (uint32_t i = 0; i < s_MetricCount; i++) {
+            const MetricDef& def = s_Defs[i];
+            MetricsEntry& entry = s_Snapshot[i];
+            std::memcpy(entry.Name, def.Name, MetricsNameSize);
+            entry.Type = (uint32_t)def.Type;
+            entry.BoundCount = def.BoundCount;
+            entry.Value = 0.0;
+            entry.Count = 0;
+            entry.Sum = 0.0;
+
+            if (def.Type == MetricType::Gauge) {
+                entry.Value = FromBits(s_Gauges[i].load(std::memory_order_relaxed));
+                continue;
+            }
+            if (def.Type == MetricType::Counter) {
+                uint64_t total = 0;
+                for (Shard* shard = head; shard; shard = shard->Next)
+                    total += shard->Values[def.FirstValue].load(std::memory_order_relaxed);
+                entry.Value = (double)total;
+                continue;
+            }
+
+            // Histogram buckets are stored per bucket and published cumulatively
+            uint64_t cumulative = 0;
+            for (uint32_t b = 0; b <= def.BoundCount; b++) {
+                for (Shard* shard = head; shard; shard = shard->Next)
+                    cumulative += shard->Values[def.FirstValue + b].load(std::memory_order_relaxed);
+                if (b < def.BoundCount) {
+                    entry.Bounds[b] = def.Bounds[b];
+                    entry.Buckets[b] = cumulative;
+                }
+            }
+            entry.Count = cumulative;
+            for (Shard* shard = head; shard; shard = shard->Next)
+                entry.Sum += FromBits(shard->Values[def.FirstValue + def.BoundCount + 1].load(std::memory_order_relaxed));
+        }
+        s_PublishCount++;
+
+        if (s_Segment) {
+            uint32_t sequence = s_Segment->Sequence.load(std::memory_order_relaxed);
+            s_Segment->Sequence.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            std::memcpy(s_Segment->Entries, s_Snapshot, s_MetricCount * sizeof(MetricsEntry));
+            s_Segment->EntryCount = s_MetricCount;
+            s_Segment->PublishCount = s_PublishCount;
+            s_Segment->TimeSeconds = timeSeconds;
+            s_Segment->Sequence.store(sequence + 2, std::memory_order_release);
+        }
+
+        if (writeProm) {
+            s_LastPromTime = timeSeconds;
+            WritePrometheus();
+        }
+    }
+
+}
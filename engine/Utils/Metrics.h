@@ -0,0 +1,45 @@
+#pragma once
+
+#include "MetricsLayout.h"
+
+#include <cstdint>
+
+namespace Groove {
+
+    typedef uint32_t MetricId;
+    static const MetricId InvalidMetric = 0xFFFFFFFFu;
+
+    // Counters, gauges and histograms for watching the engine from outside the process.
+    // Recording is lock-free from any thread: counters and histograms write to a per-thread
+    // shard that only its owner modifies, gauges are a single relaxed store. Publish sums the
+    // shards once per frame into a shared-memory segment (MetricsLayout.h) guarded by a seqlock,
+    // so readers such as tools/groove-top never block the engine, and optionally rewrites a
+    // Prometheus textfile.
+    class Metrics {
+    public:
+        // Opens the shared segment; returns false (and keeps recording) if it cannot
+        static bool Init();
+        static void Shutdown();
+
+        // Main thread, before Publish runs. Names follow Prometheus rules and may carry labels,
+        // e.g. groove_memory_bytes{tag="Renderer"}; register a family's series back to back.
+        static MetricId RegisterCounter(const char* name, const char* help);
+        static MetricId RegisterGauge(const char* name, const char* help);
+        // bounds: ascending upper bounds, at most MetricsMaxBuckets (a +Inf bucket is implied)
+        static MetricId RegisterHistogram(const char* name, const char* help, const double* bounds, uint32_t boundCount);
+
+        static void Increment(MetricId id, uint64_t delta = 1);
+        static void SetGauge(MetricId id, double value);
+        static void Observe(MetricId id, double value);
+
+        // Written to path + ".tmp" and renamed over path, as textfile collectors expect;
+        // null or interval 0 disables it
+        static void SetPrometheusFile(const char* path, float intervalSeconds);
+
+        // Main thread, once per frame
+        static void Publish(double timeSeconds);
+
+        static uint32_t GetMetricCount();
+    };
+
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+// Shared-memory layout published by Metrics and read by tools/groove-top. Plain data only, so
+// the reader can include it without linking the engine; bump MetricsVersion on any change.
+
+#include <atomic>
+#include <cstdint>
+
+namespace Groove {
+
+    static const uint32_t MetricsMagic = 0x52544D47;    // "GMTR"
+    static const uint32_t MetricsVersion = 1;
+    static const uint32_t MetricsMaxEntries = 128;
+    static const uint32_t MetricsMaxBuckets = 12;       // finite bounds; the +Inf bucket is Count
+    static const uint32_t MetricsNameSize = 64;
+
+#ifdef _WIN32
+    static const char* const MetricsSegmentName = "Local\\GrooveMetrics";
+#else
+    static const char* const MetricsSegmentName = "/groove-metrics";
+#endif
+
+    enum class MetricType : uint32_t {
+        Counter = 0,
+        Gauge,
+        Histogram
+    };
+
+    struct MetricsEntry {
+        char     Name[MetricsNameSize];              // Prometheus name, may carry labels: a{tag="b"}
+        uint32_t Type;                               // MetricType
+        uint32_t BoundCount;
+        double   Value;                              // counter total or gauge value
+        uint64_t Count;                              // histogram: observations
+        double   Sum;                                // histogram: sum of observations
+        double   Bounds[MetricsMaxBuckets];          // histogram: ascending upper bounds
+        uint64_t Buckets[MetricsMaxBuckets];         // histogram: cumulative count <= Bounds[i]
+    };
+
+    // Seqlock: the writer makes Sequence odd, writes, then makes it even again. A reader copies
+    // the segment and keeps the copy only if Sequence was even and unchanged across the copy.
+    struct MetricsSegment {
+        uint32_t Magic;
+        uint32_t Version;
+        std::atomic<uint32_t> Sequence;
+        uint32_t EntryCount;
+        uint64_t PublishCount;
+        double   TimeSeconds;                        // engine clock at publish
+        int64_t  ProcessId;
+        MetricsEntry Entries[MetricsMaxEntries];
+    };
+
+}
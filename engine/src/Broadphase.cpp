@@ -0,0 +1,172 @@
+#include "Broadphase.h"
+#include "Transform.h"
+#include "Intersection.hpp"
+#include "../Utils/JobSystem.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace Groove {
+
+    static const uint32_t SweepGrain = 1024;
+
+    static bool PairLess(const BroadphasePair& l, const BroadphasePair& r) {
+        return l.A != r.A ? l.A < r.A : l.B < r.B;
+    }
+
+    void SweepAndPrune::ComputeBounds(const Transform* transforms, uint32_t count) {
+        for (int axis = 0; axis < 3; axis++) {
+            m_Min[axis].resize(count);
+            m_Max[axis].resize(count);
+        }
+        JobSystem::ParallelFor(count, 4096, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; i++) {
+                glm::vec3 mn, mx;
+                transforms[i].GetBounds(mn, mx);
+                for (int axis = 0; axis < 3; axis++) {
+                    m_Min[axis][i] = mn[axis];
+                    m_Max[axis][i] = mx[axis];
+                }
+            }
+        });
+    }
+
+    // Sweep along the axis where the boxes are most spread out (fewest false overlaps)
+    uint32_t SweepAndPrune::ChooseSweepAxis() const {
+        const uint32_t count = (uint32_t)m_Min[0].size();
+        double best = -1.0;
+        uint32_t bestAxis = 0;
+        for (uint32_t axis = 0; axis < 3; axis++) {
+            double sum = 0.0, sumSq = 0.0;
+            for (uint32_t i = 0; i < count; i++) {
+                double c = 0.5 * (m_Min[axis][i] + m_Max[axis][i]);
+                sum += c;
+                sumSq += c * c;
+            }
+            double variance = sumSq / count - (sum / count) * (sum / count);
+            if (variance > best) {
+                best = variance;
+                bestAxis = axis;
+            }
+        }
+        return bestAxis;
+    }
+
+    void SweepAndPrune::Update(const Transform* transforms, uint32_t count) {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        ComputeBounds(transforms, count);
+        m_Pairs.clear();
+        m_Stats.InsertionSwaps = 0;
+
+        if (count < 2) {
+            m_Stats.ObjectCount = count;
+            m_Stats.PairCount = 0;
+            return;
+        }
+
+        // Re-pick the axis only when the set changes; switching would throw away the sorted order
+        bool rebuild = m_Order.size() != count;
+        if (rebuild) {
+            m_Axis = ChooseSweepAxis();
+            m_Order.resize(count);
+            for (uint32_t i = 0; i < count; i++)
+                m_Order[i] = i;
+            std::sort(m_Order.begin(), m_Order.end(), [&](uint32_t a, uint32_t b) {
+                return m_Min[m_Axis][a] < m_Min[m_Axis][b];
+            });
+            m_SortedMin.resize(count);
+        }
+
+        // Refresh keys in last update's order, then repair with insertion sort (temporal coherence)
+        const std::vector<float>& axisMin = m_Min[m_Axis];
+        for (uint32_t k = 0; k < count; k++)
+            m_SortedMin[k] = axisMin[m_Order[k]];
+
+        uint64_t swaps = 0;
+        for (uint32_t k = 1; k < count; k++) {
+            float key = m_SortedMin[k];
+            uint32_t id = m_Order[k];
+            uint32_t j = k;
+            while (j > 0 && m_SortedMin[j - 1] > key) {
+                m_SortedMin[j] = m_SortedMin[j - 1];
+                m_Order[j] = m_Order[j - 1];
+                j--;
+            }
+            m_SortedMin[j] = key;
+            m_Order[j] = id;
+            swaps += k - j;
+        }
+
+        // Gather the remaining bounds into sweep order
+        const uint32_t otherAxis[2] = { (m_Axis + 1) % 3, (m_Axis + 2) % 3 };
+        m_SweepMax.resize(count);
+        for (int o = 0; o < 2; o++) {
+            m_OtherMin[o].resize(count);
+            m_OtherMax[o].resize(count);
+        }
+        JobSystem::ParallelFor(count, 8192, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t k = begin; k < end; k++) {
+                uint32_t id = m_Order[k];
+                m_SweepMax[k] = m_Max[m_Axis][id];
+                for (int o = 0; o < 2; o++) {
+                    m_OtherMin[o][k] = m_Min[otherAxis[o]][id];
+                    m_OtherMax[o][k] = m_Max[otherAxis[o]][id];
+                }
+            }
+        });
+
+        // Sweep: every box only looks forward at boxes whose min starts before its max ends.
+        // Chunks are independent, each writes its own pair list.
+        const uint32_t chunkCount = (count + SweepGrain - 1) / SweepGrain;
+        if (m_ChunkPairs.size() < chunkCount)
+            m_ChunkPairs.resize(chunkCount);
+
+        JobSystem::ParallelFor(count, SweepGrain, [&](uint32_t begin, uint32_t end) {
+            std::vector<BroadphasePair>& out = m_ChunkPairs[begin / SweepGrain];
+            out.clear();
+            const float* sortedMin = m_SortedMin.data();
+            const float* min0 = m_OtherMin[0].data();
+            const float* max0 = m_OtherMax[0].data();
+            const float* min1 = m_OtherMin[1].data();
+            const float* max1 = m_OtherMax[1].data();
+
+            for (uint32_t k = begin; k < end; k++) {
+                const float sweepMax = m_SweepMax[k];
+                for (uint32_t j = k + 1; j < count && sortedMin[j] <= sweepMax; j++) {
+                    if (min0[j] <= max0[k] && max0[j] >= min0[k] &&
+                        min1[j] <= max1[k] && max1[j] >= min1[k]) {
+                        uint32_t a = m_Order[k], b = m_Order[j];
+                        out.push_back(a < b ? BroadphasePair{ a, b } : BroadphasePair{ b, a });
+                    }
+                }
+            }
+        });
+
+        for (uint32_t c = 0; c < chunkCount; c++)
+            m_Pairs.insert(m_Pairs.end(), m_ChunkPairs[c].begin(), m_ChunkPairs[c].end());
+        std::sort(m_Pairs.begin(), m_Pairs.end(), PairLess);
+
+        m_Stats.ObjectCount = count;
+        m_Stats.PairCount = (uint32_t)m_Pairs.size();
+        m_Stats.SweepAxis = m_Axis;
+        m_Stats.InsertionSwaps = swaps;
+        m_Stats.UpdateMs = std::chrono::duration<float, std::milli>(
+            std::chrono::high_resolution_clock::now() - start).count();
+    }
+
+    void SweepAndPrune::BruteForce(const Transform* transforms, uint32_t count, std::vector<BroadphasePair>& outPairs) {
+        outPairs.clear();
+        std::vector<glm::vec3> mins(count), maxs(count);
+        for (uint32_t i = 0; i < count; i++)
+            transforms[i].GetBounds(mins[i], maxs[i]);
+
+        for (uint32_t a = 0; a < count; a++) {
+            for (uint32_t b = a + 1; b < count; b++) {
+                if (AABBIntersectsAABB(mins[a], maxs[a], mins[b], maxs[b]))
+                    outPairs.push_back({ a, b });
+            }
+        }
+    }
+
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Groove {
+
+    struct Transform;
+
+    // Overlapping pair of object indices, always A < B
+    struct BroadphasePair {
+        uint32_t A, B;
+
+        bool operator==(const BroadphasePair& o) const { return A == o.A && B == o.B; }
+    };
+
+    struct BroadphaseStats {
+        uint32_t ObjectCount = 0;
+        uint32_t PairCount = 0;
+        uint32_t SweepAxis = 0;
+        uint64_t InsertionSwaps = 0;   // work done keeping the endpoints sorted this update
+        float    UpdateMs = 0.0f;
+    };
+
+    // Sweep-and-prune broadphase over world AABBs derived from Transforms (unit cube scaled,
+    // rotated and translated). Bounds live in SoA arrays; the min endpoints on the sweep axis
+    // stay sorted between updates and are repaired with an insertion sort, which is close to
+    // O(n) when objects move a little per tick. The sweep itself runs on the JobSystem.
+    class SweepAndPrune {
+    public:
+        void Update(const Transform* transforms, uint32_t count);
+
+        // Sorted by (A, B), identical for identical input regardless of thread timing
+        const std::vector<BroadphasePair>& GetPairs() const { return m_Pairs; }
+        const BroadphaseStats& GetStats() const { return m_Stats; }
+
+        // O(n^2) reference over the same bounds, for validation and comparison
+        static void BruteForce(const Transform* transforms, uint32_t count, std::vector<BroadphasePair>& outPairs);
+
+    private:
+        void ComputeBounds(const Transform* transforms, uint32_t count);
+        uint32_t ChooseSweepAxis() const;
+
+        // Per-object bounds, SoA, indexed by object
+        std::vector<float> m_Min[3], m_Max[3];
+
+        // Sweep axis endpoints in sorted order (keys + owning object)
+        std::vector<float>    m_SortedMin;
+        std::vector<uint32_t> m_Order;
+        uint32_t m_Axis = 0;
+
+        // Bounds gathered into sweep order so the inner loop reads contiguously
+        std::vector<float> m_SweepMax;
+        std::vector<float> m_OtherMin[2], m_OtherMax[2];
+
+        std::vector<std::vector<BroadphasePair>> m_ChunkPairs;
+        std::vector<BroadphasePair> m_Pairs;
+        BroadphaseStats m_Stats;
+    };
+
+}
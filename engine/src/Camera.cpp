@@ -6,6 +6,7 @@ namespace Groove {
     // Define the constructor here
     Camera::Camera(float fovY, float aspect, float nearClip, float farClip)
         : m_Position(0.0f, 0.0f, 3.0f) // Default camera position set to (0,0,3)
+        , m_NearClip(nearClip), m_FarClip(farClip)
     {
         m_Projection = glm::perspective(glm::radians(fovY), aspect, nearClip, farClip);
         UpdateCameraVectors();
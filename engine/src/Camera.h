@@ -14,6 +14,8 @@ namespace Groove {
             // Set perspective projection matrix  
             void SetPerspective(float fovY, float aspect, float nearClip, float farClip) {  
                 m_Projection = glm::perspective(fovY, aspect, nearClip, farClip);  
+                m_NearClip = nearClip;
+                m_FarClip = farClip;
             }
         void ProcessKeyboard(const glm::vec3& direction, float deltaTime);
         void ProcessMouseMovement(float deltaX, float deltaY, bool constrainPitch = true);
@@ -21,6 +23,9 @@ namespace Groove {
         // getters
         glm::mat4 GetViewMatrix() const;
         glm::mat4 GetProjectionMatrix() const;
+        const glm::vec3& GetPosition() const { return m_Position; }
+        float GetNearClip() const { return m_NearClip; }
+        float GetFarClip() const { return m_FarClip; }
         float GetPitch() const { return m_Pitch; }
         float GetYaw() const {
             return m_Yaw;
@@ -48,6 +53,8 @@ namespace Groove {
         glm::vec3 m_WorldUp{ 0.0f, 1.0f,  0.0f };
 
         glm::mat4 m_Projection{ 1.0f };
+        float m_NearClip = 0.1f;
+        float m_FarClip = 100.0f;
     };
 
 }
@@ -6,19 +6,40 @@
 #include "../Renderer/Renderer.h"
 #include "../Utils/Logger.h"
 #include "../Input/Input.h"
+#include "../Input/InputRecording.h"
 #include "../Renderer/ImGuiLayer.h"
+#include "../Renderer/LODSelector.h"
+#include "../Renderer/Mesh.h"
+#include "../Renderer/ClusteredLighting.h"
+#include "../Renderer/StaticBatch.h"
+#include "../Renderer/GPUPicker.h"
+#include "../Renderer/ParticleSystem.h"
+#include "../Renderer/CascadedShadowMap.h"
+#include "../Renderer/DynamicResolution.h"
+#include "../Utils/JobSystem.h"
+#include "../Utils/Memory.h"
+#include "../Utils/MemoryTracker.h"
+#include "../Utils/Metrics.h"
+#include "../Utils/BatchMath.h"
 #include "Camera.h"
+#include "Broadphase.h"
+#include "SpatialHashGrid.h"
+#include "SceneFile.h"
+#include "Frustum.hpp"
 #include "Transform.h"
 #include "MousePicker.hpp"
 #include "Intersection.hpp" // Added this to include RayIntersectsAABB
 #include <cfloat> // For FLT_MAX
+#include <cmath>
 
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 #include <imgui.h> // Ensure ImGui is included for ImGui::Begin/End/Text
-#include <sstream>
 #include <glm/gtc/type_ptr.hpp> // Include for glm::value_ptr
 #include <vector> // Required for std::vector
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
 
 static Groove::Window* s_Window = nullptr;
 static Groove::ImGuiLayer* s_ImGuiLayer = nullptr;
@@ -28,17 +49,641 @@ static Groove::Camera* m_Camera = nullptr;
 
 // Store transforms in a vector for picking (file-scope)
 static std::vector<Groove::Transform> m_Transforms;
+static std::vector<std::string> s_EntityNames;
+// World bounds of m_Transforms from BatchMath, refreshed after animation; picking reads last frame's
+static std::vector<glm::vec3> s_CubeMin, s_CubeMax;
 
-// Helper function to convert glm::vec3 to string
-static std::string Vec3ToString(const glm::vec3& vec) {
-    std::ostringstream oss;
-    oss << "(" << vec.x << ", " << vec.y << ", " << vec.z << ")";
-    return oss.str();
+// Per-object LOD levels, re-evaluated every frame
+static Groove::LODSelector s_LODSelector;
+
+// LOD stress set: 100k cubes spread over a field, selected every frame but never drawn
+static const uint32_t s_LODStressCount = 100000;
+static std::vector<Groove::Transform> s_LODStressTransforms;
+static Groove::LODSelector s_LODStressSelector;
+
+static void BuildLODStress() {
+    Groove::MemoryTagScope memTag(Groove::MemTag::Scene);
+    s_LODStressTransforms.resize(s_LODStressCount);
+    const uint32_t side = 317; // ~sqrt(100k)
+    for (uint32_t i = 0; i < s_LODStressCount; i++) {
+        Groove::Transform& t = s_LODStressTransforms[i];
+        t.Position = glm::vec3((float)(i % side) - side * 0.5f, 0.0f, -(float)(i / side)) * 2.0f;
+        t.Scale = glm::vec3(0.5f + (float)(i % 7) * 0.25f);
+    }
+}
+
+// Demo point lights orbiting the scene; count is switchable from the ImGui panel
+static std::vector<Groove::PointLight> s_Lights;
+static const int s_LightCountOptions[] = { 16, 256, 1024 };
+static int s_LightCountIndex = 0;
+static bool s_NaiveLighting = false;
+
+// Lay lights out on concentric rings around the origin with a spread of colours
+static void BuildLights(int count) {
+    s_Lights.resize(count);
+    for (int i = 0; i < count; i++) {
+        float t = (float)i / (float)count;
+        float ring = 2.0f + 6.0f * (float)(i % 8) / 8.0f;
+        float angle = t * 6.2831853f * 8.0f;
+        Groove::PointLight& light = s_Lights[i];
+        light.PositionRadius = glm::vec4(cosf(angle) * ring, -1.0f + 2.0f * (float)((i * 7) % 5) / 4.0f,
+                                         sinf(angle) * ring, 2.5f);
+        light.ColorIntensity = glm::vec4(0.5f + 0.5f * cosf(angle), 0.5f + 0.5f * cosf(angle + 2.1f),
+                                         0.5f + 0.5f * cosf(angle + 4.2f), 16.0f / (float)count + 0.5f);
+    }
+}
+
+// Picking backends: CPU ray vs AABB, or GPU entity-ID buffer with async readback
+enum class PickingBackend { RayCast = 0, GPUIDBuffer = 1 };
+static int s_PickingBackend = (int)PickingBackend::RayCast;
+static Groove::GPUPicker* s_GPUPicker = nullptr;
+static uint64_t s_FrameIndex = 0;
+static float s_PickCpuMs = 0.0f;
+static Groove::PickResult s_LastGPUPick;
+// Last pick of each backend, kept across backend switches so the panel can compare them
+struct PickSample {
+    float    CpuMs = 0.0f;      // cost on the submitting frame
+    float    LatencyMs = 0.0f;  // until the result is known (equal to CpuMs for the ray cast)
+    uint32_t FramesLatency = 0;
+    uint32_t ObjectCount = 0;   // pickable objects at the time
+    bool     Valid = false;
+};
+static PickSample s_PickSamples[2];
+static uint32_t s_GPUPickObjectCount = 0;
+
+// Pick benchmark: both backends at the same fixed grid of window points, one point per frame,
+// so their cost and agreement can be reproduced (build the 1M static level to compare at scale)
+static const uint32_t s_PickBenchGrid = 6;
+static const uint32_t s_PickBenchPoints = s_PickBenchGrid * s_PickBenchGrid;
+struct PickBenchmark {
+    bool     Active = false;
+    bool     Done = false;
+    uint32_t Submitted = 0;         // points whose ID pass is queued
+    uint32_t Resolved = 0;          // points whose readback has landed
+    int      RayHits[s_PickBenchPoints] = {};
+    double   RayMs = 0.0, SubmitMs = 0.0, LatencyMs = 0.0;
+    uint32_t Frames = 0, Agreed = 0, ObjectCount = 0;
+};
+static PickBenchmark s_PickBench;
+
+// Spatial grid over the scene cubes for region queries; Shift + left drag marquee-selects
+static Groove::SpatialHashGrid s_SceneGrid(1.0f);
+static std::vector<uint32_t> s_CubeGridHandles;
+static std::vector<uint32_t> s_Selection;        // fixed capacity, queries never grow it
+static const uint32_t s_SelectionCapacity = 65536;
+static uint32_t s_SelectionCount = 0;
+static float s_MarqueeMs = 0.0f;
+static bool s_MarqueeActive = false;
+static glm::vec2 s_MarqueeStart{ 0.0f };
+
+static void InsertIntoSceneGrid(const Groove::Transform& t, std::vector<uint32_t>* outHandles) {
+    glm::vec3 min, max;
+    t.GetBounds(min, max);
+    uint32_t handle = s_SceneGrid.Insert(min, max);
+    if (outHandles)
+        outHandles->push_back(handle);
+}
+
+// Static level geometry: a grid of cubes merged into one StaticBatch. The 1M size is there to
+// compare the pickers at scale.
+static const int s_StaticLevelSides[] = { 224, 1000 }; // ~50k, 1M objects
+static int s_StaticLevelSizeIndex = 0;
+static std::vector<Groove::Transform> s_StaticLevel;
+static std::vector<uint32_t> s_StaticGridHandles;
+static Groove::StaticBatch* s_StaticBatch = nullptr;
+static bool s_ShowStaticLevel = false;
+static bool s_DrawStaticIndividually = false;
+
+static void BuildStaticLevel() {
+    Groove::MemoryTagScope memTag(Groove::MemTag::Scene);
+    for (uint32_t handle : s_StaticGridHandles)
+        s_SceneGrid.Remove(handle);
+    s_StaticGridHandles.clear();
+    s_StaticLevel.clear();
+    s_StaticBatch->Clear();
+    const int side = s_StaticLevelSides[s_StaticLevelSizeIndex];
+    s_StaticLevel.reserve((size_t)side * side);
+    s_StaticGridHandles.reserve((size_t)side * side);
+    uint32_t light = s_StaticBatch->AddMaterial(glm::vec3(0.6f, 0.6f, 0.65f));
+    uint32_t dark = s_StaticBatch->AddMaterial(glm::vec3(0.25f, 0.25f, 0.3f));
+
+    for (int z = 0; z < side; z++) {
+        for (int x = 0; x < side; x++) {
+            Groove::Transform t;
+            t.Position = glm::vec3((x - side / 2) * 1.0f, -2.0f, (z - side / 2) * 1.0f);
+            t.Scale = glm::vec3(0.9f, 0.2f + 0.1f * (float)((x * 31 + z * 17) % 5), 0.9f);
+            s_StaticLevel.push_back(t);
+            InsertIntoSceneGrid(t, &s_StaticGridHandles);
+            s_StaticBatch->Add(Groove::Renderer::GetCubeMesh(), t.GetMatrix(), ((x + z) & 1) ? dark : light);
+        }
+    }
+    s_StaticBatch->Build();
+}
+
+// Static objects both pickers cover (the level when shown); their ids follow the cubes'
+static uint32_t PickableStaticCount() {
+    return s_ShowStaticLevel && s_StaticBatch->IsBuilt() ? s_StaticBatch->GetObjectCount() : 0;
+}
+
+// Ray cast picking: closest ray/AABB hit over every pickable object, -1 for a miss. Hits past
+// maxDistance (the far plane) aren't drawn, so they don't count, same as for the ID buffer.
+static int RayCastScene(const glm::vec3& origin, const glm::vec3& dir, float maxDistance) {
+    float closestT = maxDistance;
+    int hitIndex = -1;
+    const uint32_t cubeCount = (uint32_t)s_CubeMin.size();
+    for (uint32_t i = 0; i < cubeCount; i++) {
+        float t;
+        if (Groove::RayIntersectsAABB(origin, dir, s_CubeMin[i], s_CubeMax[i], t) && t < closestT) {
+            closestT = t;
+            hitIndex = (int)i;
+        }
+    }
+    const uint32_t staticCount = PickableStaticCount();
+    const glm::vec3* staticMin = s_StaticBatch->GetObjectMin();
+    const glm::vec3* staticMax = s_StaticBatch->GetObjectMax();
+    for (uint32_t i = 0; i < staticCount; i++) {
+        float t;
+        if (Groove::RayIntersectsAABB(origin, dir, staticMin[i], staticMax[i], t) && t < closestT) {
+            closestT = t;
+            hitIndex = (int)(cubeCount + i);
+        }
+    }
+    return hitIndex;
+}
+
+static void LogPickedObject(uint32_t id) {
+    const uint32_t cubeCount = (uint32_t)s_CubeMin.size();
+    if (id < cubeCount)
+        Groove::Logger::Info(Groove::Memory::GetFrameArena().Format("Clicked object #%u", id));
+    else
+        Groove::Logger::Info(Groove::Memory::GetFrameArena().Format("Clicked static object #%u", id - cubeCount));
+}
+
+static void DrawPickIDs(const std::vector<Groove::Transform>& transforms, Groove::Camera& cam) {
+    const uint32_t cubeCount = (uint32_t)transforms.size();
+    Groove::Renderer::DrawCubesID(transforms.data(), cubeCount, cam, 0);
+    if (PickableStaticCount())
+        Groove::Renderer::DrawStaticBatchID(*s_StaticBatch, cam, cubeCount);
+}
+
+// Ray cast and ID pass for the next benchmark point. Runs where the GPU pick pass runs, after
+// the cube bounds are refreshed, so both backends see the same scene.
+static void StepPickBenchmark(const std::vector<Groove::Transform>& transforms, Groove::Camera& cam,
+                              Groove::Window& window) {
+    PickBenchmark& bench = s_PickBench;
+    if (bench.Submitted == 0 && s_GPUPicker->GetPendingCount())
+        return; // let picks made before the run land first, so results line up with points
+    if (bench.Submitted == s_PickBenchPoints || s_GPUPicker->GetPendingCount() == Groove::GPUPicker::RingSize)
+        return;
+
+    const uint32_t point = bench.Submitted;
+    const double x = (point % s_PickBenchGrid + 0.5) / s_PickBenchGrid * window.GetWidth();
+    const double y = (point / s_PickBenchGrid + 0.5) / s_PickBenchGrid * window.GetHeight();
+
+    double start = glfwGetTime();
+    auto ray = Groove::CastRayFromScreen(cam, window, x, y);
+    bench.RayHits[point] = RayCastScene(ray.first, ray.second, cam.GetFarClip());
+    bench.RayMs += (glfwGetTime() - start) * 1000.0;
+
+    start = glfwGetTime();
+    if (s_GPUPicker->BeginPass(x, y, s_FrameIndex)) {
+        DrawPickIDs(transforms, cam);
+        s_GPUPicker->EndPass();
+        bench.SubmitMs += (glfwGetTime() - start) * 1000.0;
+        bench.ObjectCount = (uint32_t)transforms.size() + PickableStaticCount();
+        bench.Submitted++;
+    }
+}
+
+static void ResolvePickBenchmark(const Groove::PickResult& pick) {
+    PickBenchmark& bench = s_PickBench;
+    const int expected = bench.RayHits[bench.Resolved++];
+    if (pick.Hit ? expected == (int)pick.EntityID : expected < 0)
+        bench.Agreed++;
+    bench.LatencyMs += pick.LatencyMs;
+    bench.Frames += pick.FramesLatency;
+    if (bench.Resolved < s_PickBenchPoints)
+        return;
+
+    bench.Active = false;
+    bench.Done = true;
+    Groove::Logger::Info(Groove::Memory::GetFrameArena().Format(
+        "Pick benchmark: %u points over %u objects | ray cast %g ms/pick | ID pass %g ms/pick CPU, "
+        "result after %g frames / %g ms | backends agree on %u/%u",
+        s_PickBenchPoints, bench.ObjectCount, bench.RayMs / s_PickBenchPoints, bench.SubmitMs / s_PickBenchPoints,
+        (double)bench.Frames / s_PickBenchPoints, bench.LatencyMs / s_PickBenchPoints, bench.Agreed, s_PickBenchPoints));
+}
+
+static void RecordPickSample(PickingBackend backend, float cpuMs, float latencyMs, uint32_t frames, uint32_t objects) {
+    PickSample& sample = s_PickSamples[(int)backend];
+    sample.CpuMs = cpuMs;
+    sample.LatencyMs = latencyMs;
+    sample.FramesLatency = frames;
+    sample.ObjectCount = objects;
+    sample.Valid = true;
+}
+
+// Broadphase stress test: boxes drifting inside a volume, sized so ~1 neighbour overlaps each
+static const int s_BroadphaseCountOptions[] = { 0, 10000, 100000 };
+static int s_BroadphaseCountIndex = 0;
+static std::vector<Groove::Transform> s_BroadphaseBodies;
+static std::vector<glm::vec3> s_BroadphaseVelocities;
+static Groove::SweepAndPrune s_Broadphase;
+static std::vector<Groove::BroadphasePair> s_BruteForcePairs;
+static bool s_BroadphaseBruteForce = false;
+static float s_BruteForceMs = 0.0f;
+static const int s_BruteForceMaxObjects = 10000; // n^2 beyond this stalls the frame for seconds
+// Above that cap brute force only runs on request, once, timed against that frame's SAP update
+static bool s_BruteForceOneShotRequested = false;
+static uint32_t s_BruteForceOneShotCount = 0;
+static float s_BruteForceOneShotMs = 0.0f;
+static float s_BruteForceOneShotSapMs = 0.0f;
+
+static float BroadphaseVolumeSide(int count) {
+    return 4.0f * cbrtf((float)count);
+}
+
+static void BuildBroadphaseBodies(int count) {
+    Groove::MemoryTagScope memTag(Groove::MemTag::Physics);
+    s_BroadphaseBodies.resize(count);
+    s_BroadphaseVelocities.resize(count);
+    float side = BroadphaseVolumeSide(count);
+    uint32_t seed = 12345u;
+    auto next = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return (float)(seed >> 8) / 16777216.0f;
+    };
+    for (int i = 0; i < count; i++) {
+        Groove::Transform& t = s_BroadphaseBodies[i];
+        t.Position = glm::vec3(next(), next(), next()) * side;
+        t.Rotation = glm::vec3(0.0f, next() * 90.0f, 0.0f);
+        t.Scale = glm::vec3(0.5f + next() * 1.5f);
+        s_BroadphaseVelocities[i] = (glm::vec3(next(), next(), next()) - 0.5f) * 2.0f;
+    }
+}
+
+static void UpdateBroadphaseBodies(float deltaTime) {
+    Groove::MemoryTagScope memTag(Groove::MemTag::Physics);
+    const uint32_t count = (uint32_t)s_BroadphaseBodies.size();
+    const float side = BroadphaseVolumeSide((int)count);
+    Groove::JobSystem::ParallelFor(count, 8192, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; i++) {
+            glm::vec3& p = s_BroadphaseBodies[i].Position;
+            glm::vec3& v = s_BroadphaseVelocities[i];
+            p += v * deltaTime;
+            for (int axis = 0; axis < 3; axis++) {
+                if ((p[axis] < 0.0f && v[axis] < 0.0f) || (p[axis] > side && v[axis] > 0.0f))
+                    v[axis] = -v[axis];
+            }
+        }
+    });
+
+    s_Broadphase.Update(s_BroadphaseBodies.data(), count);
+
+    s_BruteForceMs = 0.0f;
+    if (s_BroadphaseBruteForce && count <= (uint32_t)s_BruteForceMaxObjects) {
+        double start = glfwGetTime();
+        Groove::SweepAndPrune::BruteForce(s_BroadphaseBodies.data(), count, s_BruteForcePairs);
+        s_BruteForceMs = (float)((glfwGetTime() - start) * 1000.0);
+        if (s_BruteForcePairs != s_Broadphase.GetPairs())
+            Groove::Logger::Error("Broadphase: sweep-and-prune pairs differ from brute force");
+    }
+
+    if (s_BruteForceOneShotRequested) {
+        s_BruteForceOneShotRequested = false;
+        double start = glfwGetTime();
+        Groove::SweepAndPrune::BruteForce(s_BroadphaseBodies.data(), count, s_BruteForcePairs);
+        s_BruteForceOneShotMs = (float)((glfwGetTime() - start) * 1000.0);
+        s_BruteForceOneShotSapMs = s_Broadphase.GetStats().UpdateMs;
+        s_BruteForceOneShotCount = count;
+        const bool match = s_BruteForcePairs == s_Broadphase.GetPairs();
+        Groove::Logger::Info(Groove::Memory::GetFrameArena().Format(
+            "Broadphase one-shot: %u bodies | brute force %g ms | SAP %g ms | %.0fx | pairs %s",
+            count, s_BruteForceOneShotMs, s_BruteForceOneShotSapMs,
+            s_BruteForceOneShotSapMs > 0.0f ? s_BruteForceOneShotMs / s_BruteForceOneShotSapMs : 0.0f,
+            match ? "match" : "DIFFER"));
+        if (!match)
+            Groove::Logger::Error("Broadphase: sweep-and-prune pairs differ from brute force");
+        s_BruteForcePairs.clear();
+        s_BruteForcePairs.shrink_to_fit();
+    }
+}
+
+// Grid benchmark: 1M boxes, 10% of them move every frame
+static const uint32_t s_GridBenchCount = 1000000;
+static Groove::SpatialHashGrid* s_GridBench = nullptr;
+static std::vector<glm::vec3> s_GridBenchMin, s_GridBenchMax;
+static std::vector<uint32_t> s_GridBenchResults;
+static uint32_t s_GridBenchCursor = 0;
+static float s_GridMoveMs = 0.0f, s_GridSphereMs = 0.0f, s_GridNearestMs = 0.0f;
+static uint32_t s_GridSphereCount = 0;
+static float s_GridNearestDistance = 0.0f;
+
+static void BuildGridBench() {
+    Groove::MemoryTagScope memTag(Groove::MemTag::Scene);
+    s_GridBench = new Groove::SpatialHashGrid(2.0f);
+    s_GridBench->Reserve(s_GridBenchCount);
+    s_GridBenchMin.resize(s_GridBenchCount);
+    s_GridBenchMax.resize(s_GridBenchCount);
+    s_GridBenchResults.resize(s_SelectionCapacity);
+    uint32_t seed = 777u;
+    auto next = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return (float)(seed >> 8) / 16777216.0f;
+    };
+    for (uint32_t i = 0; i < s_GridBenchCount; i++) {
+        glm::vec3 center = glm::vec3(next() - 0.5f, (next() - 0.5f) * 0.25f, next() - 0.5f) * 200.0f;
+        glm::vec3 half(0.25f + next() * 0.5f);
+        s_GridBenchMin[i] = center - half;
+        s_GridBenchMax[i] = center + half;
+        s_GridBench->Insert(s_GridBenchMin[i], s_GridBenchMax[i]);
+    }
+}
+
+static void UpdateGridBench(float time) {
+    const uint32_t moveCount = s_GridBenchCount / 10;
+    double start = glfwGetTime();
+    for (uint32_t n = 0; n < moveCount; n++) {
+        uint32_t i = s_GridBenchCursor;
+        s_GridBenchCursor = (s_GridBenchCursor + 1) % s_GridBenchCount;
+        glm::vec3 offset(0.05f * cosf(time + (float)i), 0.0f, 0.05f * sinf(time + (float)i));
+        s_GridBenchMin[i] += offset;
+        s_GridBenchMax[i] += offset;
+        s_GridBench->Move(i, s_GridBenchMin[i], s_GridBenchMax[i]);
+    }
+    s_GridMoveMs = (float)((glfwGetTime() - start) * 1000.0);
+
+    start = glfwGetTime();
+    s_GridSphereCount = s_GridBench->QuerySphere(m_Camera->GetPosition(), 10.0f, s_GridBenchResults.data(), s_SelectionCapacity);
+    s_GridSphereMs = (float)((glfwGetTime() - start) * 1000.0);
+
+    uint32_t nearest[16];
+    float distances[16];
+    start = glfwGetTime();
+    uint32_t found = s_GridBench->QueryNearest(m_Camera->GetPosition(), 16, nearest, distances);
+    s_GridNearestMs = (float)((glfwGetTime() - start) * 1000.0);
+    s_GridNearestDistance = found ? distances[found - 1] : 0.0f;
+}
+
+// Scene snapshots: binary chunked file, incremental transform saves, 1M-entity load benchmark
+static const char* s_ScenePath = "Groove.gscn";
+static float s_SceneIOMs = 0.0f;
+static const char* s_SceneIOAction = "";
+static const uint32_t s_SceneBenchCount = 1000000;
+static float s_SceneBenchBinaryMapMs = 0.0f, s_SceneBenchBinaryLoadMs = 0.0f, s_SceneBenchJsonLoadMs = 0.0f;
+static bool s_SceneBenchDone = false;
+
+// GPU particles with an optional CPU reference running in lockstep for comparison
+static const uint32_t s_ParticleCapacity = 1u << 20;
+static Groove::ParticleSystem* s_Particles = nullptr;
+static Groove::ParticleSystemCPU* s_ParticlesCPU = nullptr;
+static Groove::ParticleEmitter s_ParticleEmitter;
+static Groove::ParticleValidation s_ParticleValidation;
+static bool s_ParticleValidated = false;
+
+// Sun with cascaded shadows; shadow cost is averaged separately with and without caching
+static Groove::DirectionalLight s_Sun;
+static float s_SunYaw = -143.0f, s_SunPitch = 63.0f;   // degrees, matches the default direction
+static bool s_SunShadows = true;
+static bool s_ShadowCaching = true;
+static float s_ShadowAvgDraws[2] = {}, s_ShadowAvgCpuMs[2] = {}, s_ShadowAvgGpuMs[2] = {};   // [caching]
+
+// Scene rendered offscreen at a GPU-time-driven scale, upscaled before ImGui
+static Groove::DynamicResolution* s_DynamicResolution = nullptr;
+static bool s_DynamicResolutionEnabled = false;
+
+// SIMD batch transform kernels: accuracy vs glm and throughput for every supported path
+static Groove::BatchMathReport s_BatchMathReports[(int)Groove::BatchMathPath::Count];
+static bool s_BatchMathValidated = false;
+
+static void RunBatchMathValidation() {
+    for (int path = 0; path < (int)Groove::BatchMathPath::Count; path++) {
+        if (!Groove::BatchMath::IsSupported((Groove::BatchMathPath)path))
+            continue;
+        const Groove::BatchMathReport& r = s_BatchMathReports[path] = Groove::BatchMath::Validate((Groove::BatchMathPath)path);
+        Groove::Logger::Info(Groove::Memory::GetFrameArena().Format(
+            "BatchMath %s %s: compose %.1f M/s (err %g) | multiply %.1f M/s (err %g) | AABB %.1f M/s (err %g) | sincos err %g",
+            Groove::BatchMath::GetPathName(r.Path), r.Passed ? "PASS" : "FAIL", r.ComposeMPerSec, r.ComposeError,
+            r.MultiplyMPerSec, r.MultiplyError, r.AABBMPerSec, r.AABBError, r.SinCosError));
+    }
+    s_BatchMathValidated = true;
+}
+
+static void LoadSceneFromFile() {
+    Groove::MemoryTagScope memTag(Groove::MemTag::Scene);
+    Groove::SceneData scene;
+    if (!Groove::LoadScene(s_ScenePath, scene))
+        return;
+
+    for (uint32_t handle : s_CubeGridHandles)
+        s_SceneGrid.Remove(handle);
+    s_CubeGridHandles.clear();
+
+    m_Transforms.swap(scene.Transforms);
+    s_EntityNames.swap(scene.Names);
+    for (const auto& t : m_Transforms)
+        InsertIntoSceneGrid(t, &s_CubeGridHandles);
+}
+
+// Save 1M entities both ways, then time reading through the mapping, copying out, and parsing JSON
+static void RunSceneBenchmark() {
+    Groove::MemoryTagScope memTag(Groove::MemTag::Scene);
+    std::vector<Groove::Transform> transforms(s_SceneBenchCount);
+    std::vector<std::string> names(s_SceneBenchCount);
+    for (uint32_t i = 0; i < s_SceneBenchCount; i++) {
+        transforms[i].Position = glm::vec3((float)(i % 1000), 0.0f, (float)(i / 1000));
+        transforms[i].Rotation = glm::vec3(0.0f, (float)(i % 360), 0.0f);
+        char name[32];
+        std::snprintf(name, sizeof(name), "Entity %u", i);
+        names[i] = name;
+    }
+    Groove::SaveScene("GrooveBench.gscn", transforms.data(), names.data(), s_SceneBenchCount);
+    Groove::SaveSceneJson("GrooveBench.json", transforms.data(), names.data(), s_SceneBenchCount);
+
+    // Reads every transform and name through the mapping, so the pages are actually faulted in
+    // like the other two paths, which copy everything out
+    double start = glfwGetTime();
+    float checksum = 0.0f;
+    size_t nameBytes = 0;
+    {
+        Groove::SceneReader reader;
+        uint64_t count = 0, nameCount = 0;
+        if (reader.Open("GrooveBench.gscn")) {
+            const Groove::Transform* mapped = reader.GetArray<Groove::Transform>(Groove::SceneChunk::Transforms, count);
+            const uint32_t* nameOffsets = reader.GetArray<uint32_t>(Groove::SceneChunk::Names, nameCount);
+            for (uint64_t i = 0; i < count; i++)
+                checksum += mapped[i].Position.x + mapped[i].Rotation.y + mapped[i].Scale.z;
+            for (uint64_t i = 0; i < nameCount; i++)
+                nameBytes += std::strlen(reader.GetString(nameOffsets[i]));
+        }
+    }
+    s_SceneBenchBinaryMapMs = (float)((glfwGetTime() - start) * 1000.0);
+
+    Groove::SceneData scene;
+    start = glfwGetTime();
+    Groove::LoadScene("GrooveBench.gscn", scene);
+    s_SceneBenchBinaryLoadMs = (float)((glfwGetTime() - start) * 1000.0);
+
+    start = glfwGetTime();
+    Groove::LoadSceneJson("GrooveBench.json", scene);
+    s_SceneBenchJsonLoadMs = (float)((glfwGetTime() - start) * 1000.0);
+
+    s_SceneBenchDone = true;
+    Groove::Logger::Info(Groove::Memory::GetFrameArena().Format(
+        "Scene load, %u entities: read in place %g ms | binary copy-out %g ms | JSON %g ms (checksum %g, %zu name bytes)",
+        s_SceneBenchCount, s_SceneBenchBinaryMapMs, s_SceneBenchBinaryLoadMs, s_SceneBenchJsonLoadMs, checksum, nameBytes));
+}
+
+// Per-subsystem memory: CPU/GPU totals, peaks, churn and budgets
+static void DrawMemoryPanel() {
+    ImGui::Begin("Memory");
+    if (ImGui::BeginTable("MemoryTags", 7, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+        ImGui::TableSetupColumn("Subsystem");
+        ImGui::TableSetupColumn("CPU KB");
+        ImGui::TableSetupColumn("CPU peak KB");
+        ImGui::TableSetupColumn("Live blocks");
+        ImGui::TableSetupColumn("Allocs/frees per frame");
+        ImGui::TableSetupColumn("GPU KB");
+        ImGui::TableSetupColumn("Budget");
+        ImGui::TableHeadersRow();
+        for (int i = 0; i < (int)Groove::MemTag::Count; i++) {
+            Groove::MemTag tag = (Groove::MemTag)i;
+            Groove::MemoryTagStats stats = Groove::MemoryTracker::GetStats(tag);
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::Text("%s", Groove::MemoryTracker::GetTagName(tag));
+            ImGui::TableNextColumn(); ImGui::Text("%.1f", stats.CpuBytes / 1024.0);
+            ImGui::TableNextColumn(); ImGui::Text("%.1f", stats.CpuPeak / 1024.0);
+            ImGui::TableNextColumn(); ImGui::Text("%lld", (long long)stats.CpuLiveAllocations);
+            ImGui::TableNextColumn(); ImGui::Text("%llu / %llu", (unsigned long long)stats.AllocsLastFrame,
+                                                  (unsigned long long)stats.FreesLastFrame);
+            ImGui::TableNextColumn(); ImGui::Text("%.1f", stats.GpuBytes / 1024.0);
+            ImGui::TableNextColumn();
+            if (stats.Budget > 0) {
+                float used = (float)(stats.CpuBytes + stats.GpuBytes) / (float)stats.Budget;
+                ImGui::ProgressBar(used > 1.0f ? 1.0f : used);
+            } else {
+                ImGui::Text("-");
+            }
+        }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+// Spin every light around the Y axis
+static void AnimateLights(float deltaTime) {
+    float c = cosf(deltaTime * 0.5f), s = sinf(deltaTime * 0.5f);
+    for (auto& light : s_Lights) {
+        glm::vec4& p = light.PositionRadius;
+        float x = p.x * c - p.z * s;
+        float z = p.x * s + p.z * c;
+        p.x = x;
+        p.z = z;
+    }
+}
+
+// Heap allocations made during the previous frame (global operator new calls)
+static uint64_t s_AllocationsLastFrame = 0;
+// Frames past warm-up with no UI interaction must not allocate; offenders are logged and counted
+static const uint64_t s_AllocationWarmupFrames = 120;
+static uint64_t s_AllocatingSteadyFrames = 0;
+// Allocation check (Config::AllocationCheckFrames): heap allocations summed over steady frames
+static uint32_t s_AllocationCheckFrames = 0;
+static uint64_t s_SteadyFrames = 0;
+static uint64_t s_SteadyFrameAllocations = 0;
+static float s_LastAllocationErrorTime = -1.0f;
+
+// Exported metrics, read live by tools/groove-top or a Prometheus textfile collector
+static Groove::MetricId s_MetricFrames, s_MetricFrameTime, s_MetricFrameWork, s_MetricDrawCalls, s_MetricTriangles;
+static Groove::MetricId s_MetricShadowCasters, s_MetricShadowCulled, s_MetricPicks, s_MetricPickLatency;
+static Groove::MetricId s_MetricAllocations, s_MetricResolutionScale;
+static Groove::MetricId s_MetricCpuBytes[(int)Groove::MemTag::Count], s_MetricGpuBytes[(int)Groove::MemTag::Count];
+
+static void RegisterMetrics() {
+    static const double frameBounds[] = { 4.0, 8.0, 12.0, 16.7, 20.0, 25.0, 33.3, 50.0, 100.0 };
+    static const double pickBounds[] = { 0.1, 0.5, 1.0, 2.0, 5.0, 10.0, 20.0, 50.0, 100.0 };
+    s_MetricFrames = Groove::Metrics::RegisterCounter("groove_frames_total", "Frames rendered");
+    s_MetricFrameTime = Groove::Metrics::RegisterHistogram("groove_frame_time_ms", "Frame-to-frame time in milliseconds",
+                                                           frameBounds, 9);
+    s_MetricFrameWork = Groove::Metrics::RegisterGauge("groove_frame_work_ms", "Input poll to swap call");
+    s_MetricDrawCalls = Groove::Metrics::RegisterGauge("groove_draw_calls", "Draw calls last frame, shadow passes included");
+    s_MetricTriangles = Groove::Metrics::RegisterGauge("groove_triangles", "Cube triangles after LOD selection");
+    s_MetricShadowCasters = Groove::Metrics::RegisterGauge("groove_shadow_casters", "Caster submissions over all cascades");
+    s_MetricShadowCulled = Groove::Metrics::RegisterGauge("groove_shadow_casters_culled",
+                                                          "Caster/cascade pairs rejected by cascade culling");
+    s_MetricPicks = Groove::Metrics::RegisterCounter("groove_picks_total", "Completed mouse picks");
+    s_MetricPickLatency = Groove::Metrics::RegisterHistogram("groove_pick_latency_ms",
+                                                             "Click to pick result in milliseconds", pickBounds, 9);
+    s_MetricAllocations = Groove::Metrics::RegisterGauge("groove_heap_allocations", "Heap allocations last frame");
+    s_MetricResolutionScale = Groove::Metrics::RegisterGauge("groove_resolution_scale", "Dynamic resolution scale, 1 when off");
+
+    char name[Groove::MetricsNameSize];
+    for (int i = 0; i < (int)Groove::MemTag::Count; i++) {
+        std::snprintf(name, sizeof(name), "groove_memory_cpu_bytes{tag=\"%s\"}", Groove::MemoryTracker::GetTagName((Groove::MemTag)i));
+        s_MetricCpuBytes[i] = Groove::Metrics::RegisterGauge(name, "Live CPU bytes per subsystem");
+    }
+    for (int i = 0; i < (int)Groove::MemTag::Count; i++) {
+        std::snprintf(name, sizeof(name), "groove_memory_gpu_bytes{tag=\"%s\"}", Groove::MemoryTracker::GetTagName((Groove::MemTag)i));
+        s_MetricGpuBytes[i] = Groove::Metrics::RegisterGauge(name, "Tracked GPU bytes per subsystem");
+    }
 }
 
-void Engine::Init() {
+// Input record/replay: a replay feeds recorded input, deltaTime and window size back in
+static Groove::InputRecorder* s_InputRecorder = nullptr;
+static Groove::InputPlayer* s_InputPlayer = nullptr;
+static Groove::InputFrame s_InputFrame;
+static int s_ViewportWidth = 0, s_ViewportHeight = 0;   // size the picker and camera were set up for
+static FILE* s_TimingCsv = nullptr;
+
+void Engine::Init(const Config& config) {
     Groove::Logger::Init("Groove.log");
-    s_Window = new Groove::Window(1280, 720, "Groove Engine");
+
+    // Budgets cover CPU + GPU bytes per subsystem; crossing one logs a warning
+    Groove::MemoryTracker::SetBudget(Groove::MemTag::Renderer, 256ll * 1024 * 1024);
+    Groove::MemoryTracker::SetBudget(Groove::MemTag::Scene, 512ll * 1024 * 1024);
+    Groove::MemoryTracker::SetBudget(Groove::MemTag::ImGui, 16ll * 1024 * 1024);
+    Groove::MemoryTracker::SetBudget(Groove::MemTag::Logger, 4ll * 1024 * 1024);
+    Groove::MemoryTracker::SetDumpFile("GrooveMemory.csv", 10.0f);
+
+    Groove::JobSystem::Init();
+    Groove::BatchMath::Init();
+    Groove::Metrics::Init();
+    RegisterMetrics();
+    if (config.MetricsPrometheusPath)
+        Groove::Metrics::SetPrometheusFile(config.MetricsPrometheusPath, 5.0f);
+
+    int windowWidth = 1280, windowHeight = 720;
+    if (config.ReplayInputPath) {
+        s_InputPlayer = new Groove::InputPlayer();
+        if (s_InputPlayer->Open(config.ReplayInputPath)) {
+            windowWidth = s_InputPlayer->GetWidth();
+            windowHeight = s_InputPlayer->GetHeight();
+            Groove::Logger::Info(Groove::Memory::GetFrameArena().Format("Replaying %u frames from %s",
+                s_InputPlayer->GetFrameCount(), config.ReplayInputPath));
+        } else {
+            delete s_InputPlayer;
+            s_InputPlayer = nullptr;
+        }
+    }
+
+    s_Window = new Groove::Window(windowWidth, windowHeight, "Groove Engine", !config.Headless);
+    if (config.Headless)
+        s_Window->SetPresentMode(Groove::PresentMode::Uncapped);
+
+    if (config.RecordInputPath && !s_InputPlayer) {
+        s_InputRecorder = new Groove::InputRecorder();
+        if (!s_InputRecorder->Open(config.RecordInputPath, (uint16_t)windowWidth, (uint16_t)windowHeight)) {
+            delete s_InputRecorder;
+            s_InputRecorder = nullptr;
+        }
+    }
+    if (config.TimingCsvPath) {
+        s_TimingCsv = std::fopen(config.TimingCsvPath, "w");
+        if (s_TimingCsv)
+            std::fprintf(s_TimingCsv, "frame,delta_ms,frame_ms,work_ms,wait_ms,lod_ms,light_cull_ms,allocations\n");
+        else
+            Groove::Logger::Error("Could not open timing CSV");
+    }
     if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
         Groove::Logger::Error("Failed to initialize GLAD!");
         return;
@@ -47,9 +692,27 @@ void Engine::Init() {
     Groove::Renderer::Init();
 
     // Aspect ratio = width/height
-    m_Camera = new Groove::Camera(45.0f, 1280.0f / 720.0f, 0.1f, 100.0f);
+    m_Camera = new Groove::Camera(45.0f, (float)windowWidth / (float)windowHeight, 0.1f, 100.0f);
     m_Camera->SetPosition(glm::vec3(0.0f, 0.0f, 3.0f)); // Move camera back so it can see the cube
 
+    s_StaticBatch = new Groove::StaticBatch();
+    s_Selection.resize(s_SelectionCapacity);
+    s_GPUPicker = new Groove::GPUPicker(s_Window->GetWidth(), s_Window->GetHeight());
+    s_ViewportWidth = s_Window->GetWidth();
+    s_ViewportHeight = s_Window->GetHeight();
+    s_DynamicResolution = new Groove::DynamicResolution();
+
+    // The allocation check turns on the per-frame systems that are off by default, so their
+    // steady state is covered too
+    s_AllocationCheckFrames = config.AllocationCheckFrames;
+    if (s_AllocationCheckFrames) {
+        Groove::MemoryTagScope memTag(Groove::MemTag::Renderer);
+        s_ShowStaticLevel = true;
+        BuildStaticLevel();
+        s_Particles = new Groove::ParticleSystem(s_ParticleCapacity);
+        s_DynamicResolutionEnabled = true;
+    }
+
     s_ImGuiLayer = new Groove::ImGuiLayer();
     s_ImGuiLayer->Init(static_cast<GLFWwindow*>(s_Window->GetNativeWindow()));
 
@@ -63,9 +726,11 @@ void Engine::Run() {
 
     float lastTime = (float)glfwGetTime();
     float logTimer = lastTime;
+    float simTime = 0.0f;
 
     // Initialize transforms only once
     if (m_Transforms.empty()) {
+        Groove::MemoryTagScope memTag(Groove::MemTag::Scene);
         m_Transforms.push_back(Groove::Transform());
         m_Transforms.push_back(Groove::Transform());
 
@@ -74,18 +739,60 @@ void Engine::Run() {
 
         m_Transforms[1].Position = glm::vec3(1.5f, 0.0f, 0.0f); // Right
         m_Transforms[1].Rotation = glm::vec3(0.0f, 45.0f, 0.0f);
+
+        s_EntityNames.push_back("Left cube");
+        s_EntityNames.push_back("Right cube");
+
+        for (const auto& t : m_Transforms)
+            InsertIntoSceneGrid(t, &s_CubeGridHandles);
     }
 
+    if (s_Lights.empty())
+        BuildLights(s_LightCountOptions[s_LightCountIndex]);
+
     GLFWwindow* glfwWin = static_cast<GLFWwindow*>(s_Window->GetNativeWindow());
 
     // Always show the cursor
     glfwSetInputMode(glfwWin, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
 
     while (!glfwWindowShouldClose(glfwWin)) {
+        // Pacing wait + input poll; everything below simulates the input sampled here
+        s_Window->BeginFrame();
+
+        uint64_t frameStartAllocations = Groove::Memory::GetAllocationCount();
         float currentTime = (float)glfwGetTime();
         float deltaTime = currentTime - lastTime;
+        float frameMs = deltaTime * 1000.0f;
         lastTime = currentTime;
 
+        // Replays take input, deltaTime and window size from the recording; recordings snapshot them
+        if (s_InputPlayer) {
+            if (!s_InputPlayer->ReadFrame(s_InputFrame)) {
+                Groove::Logger::Info("Replay finished");
+                break;
+            }
+            deltaTime = s_InputFrame.DeltaTime;
+            if (s_InputFrame.Width != s_Window->GetWidth() || s_InputFrame.Height != s_Window->GetHeight())
+                s_Window->SetSize(s_InputFrame.Width, s_InputFrame.Height);
+            Groove::Input::SetOverride(&s_InputFrame.State);
+        } else if (s_InputRecorder) {
+            Groove::Input::CaptureState(s_InputFrame.State);
+            s_InputFrame.DeltaTime = deltaTime;
+            s_InputFrame.Width = (uint16_t)s_Window->GetWidth();
+            s_InputFrame.Height = (uint16_t)s_Window->GetHeight();
+            s_InputRecorder->WriteFrame(s_InputFrame);
+            Groove::Input::SetOverride(&s_InputFrame.State);
+        }
+        // Resizes come from the replay or, live, from the window's framebuffer callback
+        if (s_Window->GetWidth() != s_ViewportWidth || s_Window->GetHeight() != s_ViewportHeight) {
+            s_ViewportWidth = s_Window->GetWidth();
+            s_ViewportHeight = s_Window->GetHeight();
+            glViewport(0, 0, s_ViewportWidth, s_ViewportHeight);
+            s_GPUPicker->Resize(s_ViewportWidth, s_ViewportHeight);
+            Groove::Renderer::SetCameraPerspective(*m_Camera, (float)s_ViewportWidth / (float)s_ViewportHeight);
+        }
+        simTime += deltaTime;
+
         // Only process camera movement/rotation if right mouse button is held
         bool rightMouseHeld = Groove::Input::IsMouseButtonPressed(GLFW_MOUSE_BUTTON_RIGHT);
 
@@ -108,109 +815,610 @@ void Engine::Run() {
             Groove::Input::GetMouseDelta(dx, dy); // Consume delta
         }
 
+        // Marquee selection: Shift + left drag, resolved against the scene grid on release
+        bool leftMouseHeld = Groove::Input::IsMouseButtonPressed(GLFW_MOUSE_BUTTON_LEFT);
+        double cursorX, cursorY;
+        Groove::Input::GetMousePosition(cursorX, cursorY);
+        if (!s_MarqueeActive && leftMouseHeld && Groove::Input::IsKeyPressed(GLFW_KEY_LEFT_SHIFT)) {
+            s_MarqueeActive = true;
+            s_MarqueeStart = glm::vec2((float)cursorX, (float)cursorY);
+        } else if (s_MarqueeActive && !leftMouseHeld) {
+            s_MarqueeActive = false;
+            double marqueeStart = glfwGetTime();
+            Groove::Frustum marquee = Groove::Frustum::FromScreenRect(*m_Camera, s_MarqueeStart.x, s_MarqueeStart.y,
+                (float)cursorX, (float)cursorY, (float)s_Window->GetWidth(), (float)s_Window->GetHeight());
+            s_SelectionCount = s_SceneGrid.QueryFrustum(marquee, s_Selection.data(), s_SelectionCapacity);
+            s_MarqueeMs = (float)((glfwGetTime() - marqueeStart) * 1000.0);
+            Groove::Logger::Info(Groove::Memory::GetFrameArena().Format("Marquee selected %u objects in %g ms",
+                s_SelectionCount, s_MarqueeMs));
+        }
+
         // Mouse picking logic (after camera update, before rendering)
 #if __cplusplus >= 201703L
-        if (Groove::Input::IsMouseButtonPressed(GLFW_MOUSE_BUTTON_LEFT)) {
+        if (s_PickingBackend == (int)PickingBackend::RayCast && leftMouseHeld && !s_MarqueeActive && !s_PickBench.Active) {
+            double pickStart = glfwGetTime();
             auto [origin, dir] = CastRayFromMouse(*m_Camera, *s_Window);
-            float closestT = FLT_MAX;
-            int hitIndex = -1;
-
-            for (int i = 0; i < (int)m_Transforms.size(); i++) {
-                const auto& T = m_Transforms[i];
-                glm::vec3 half = T.Scale * 0.5f;
-                glm::vec3 min = T.Position - half;
-                glm::vec3 max = T.Position + half;
-                float t;
-                if (RayIntersectsAABB(origin, dir, min, max, t) && t < closestT) {
-                    closestT = t;
-                    hitIndex = i;
-                }
-            }
+            int hitIndex = RayCastScene(origin, dir, m_Camera->GetFarClip());
+
+            s_PickCpuMs = (float)((glfwGetTime() - pickStart) * 1000.0);
+            RecordPickSample(PickingBackend::RayCast, s_PickCpuMs, s_PickCpuMs, 0,
+                             (uint32_t)s_CubeMin.size() + PickableStaticCount());
+            Groove::Metrics::Increment(s_MetricPicks);
+            Groove::Metrics::Observe(s_MetricPickLatency, s_PickCpuMs);
 
             if (hitIndex >= 0) {
-                Groove::Logger::Info("Clicked object #" + std::to_string(hitIndex));
+                LogPickedObject((uint32_t)hitIndex);
                 // Optionally: store selection or highlight
             }
         }
 #else
         // Fallback for pre-C++17: no structured bindings
-        if (Groove::Input::IsMouseButtonPressed(GLFW_MOUSE_BUTTON_LEFT)) {
+        if (s_PickingBackend == (int)PickingBackend::RayCast && leftMouseHeld && !s_MarqueeActive && !s_PickBench.Active) {
+            double pickStart = glfwGetTime();
             auto ray = CastRayFromMouse(*m_Camera, *s_Window);
             auto& origin = ray.first;
             auto& dir = ray.second;
-            float closestT = FLT_MAX;
-            int hitIndex = -1;
-
-            for (int i = 0; i < (int)m_Transforms.size(); i++) {
-                const auto& T = m_Transforms[i];
-                glm::vec3 half = T.Scale * 0.5f;
-                glm::vec3 min = T.Position - half;
-                glm::vec3 max = T.Position + half;
-                float t;
-                if (Groove::RayIntersectsAABB(origin, dir, min, max, t) && t < closestT) {
-                    closestT = t;
-                    hitIndex = i;
-                }
-            }
+            int hitIndex = RayCastScene(origin, dir, m_Camera->GetFarClip());
+
+            s_PickCpuMs = (float)((glfwGetTime() - pickStart) * 1000.0);
+            RecordPickSample(PickingBackend::RayCast, s_PickCpuMs, s_PickCpuMs, 0,
+                             (uint32_t)s_CubeMin.size() + PickableStaticCount());
+            Groove::Metrics::Increment(s_MetricPicks);
+            Groove::Metrics::Observe(s_MetricPickLatency, s_PickCpuMs);
 
             if (hitIndex >= 0) {
-                Groove::Logger::Info("Clicked object #" + std::to_string(hitIndex));
+                LogPickedObject((uint32_t)hitIndex);
                 // Optionally: store selection or highlight
             }
         }
 #endif
 
-        // 3) Render
+        // 3) Render: CPU-side frame preparation first, then the GPU passes
+
+        // Animate both cubes (optional: rotate both)
+        if (m_Transforms.size() >= 2) {
+            m_Transforms[0].Rotation.y += deltaTime * 50.0f;
+            m_Transforms[1].Rotation.y -= deltaTime * 30.0f;
+        }
+
+        s_LODSelector.Select(m_Transforms.data(), (uint32_t)m_Transforms.size(),
+                             Groove::Renderer::GetCubeLODChain(), Groove::Renderer::GetCubeBoundingRadius(),
+                             *m_Camera, (float)s_Window->GetHeight());
+        if (!s_LODStressTransforms.empty()) {
+            s_LODStressSelector.Settings = s_LODSelector.Settings;
+            s_LODStressSelector.Select(s_LODStressTransforms.data(), s_LODStressCount,
+                                       Groove::Renderer::GetCubeLODChain(), Groove::Renderer::GetCubeBoundingRadius(),
+                                       *m_Camera, (float)s_Window->GetHeight());
+        }
+
+        s_CubeMin.resize(m_Transforms.size());
+        s_CubeMax.resize(m_Transforms.size());
+        Groove::BatchMath::ComposeTransforms(m_Transforms.data(), (uint32_t)m_Transforms.size(), nullptr,
+                                             s_CubeMin.data(), s_CubeMax.data());
+        for (uint32_t i = 0; i < (uint32_t)m_Transforms.size(); i++)
+            s_SceneGrid.Move(s_CubeGridHandles[i], s_CubeMin[i], s_CubeMax[i]);
+
+        if (!s_BroadphaseBodies.empty())
+            UpdateBroadphaseBodies(deltaTime);
+        if (s_GridBench)
+            UpdateGridBench(simTime);
+
+        AnimateLights(deltaTime);
+        Groove::Renderer::SetLights(s_Lights.data(), (uint32_t)s_Lights.size());
+        Groove::Renderer::SetNaiveLighting(s_NaiveLighting);
+        Groove::Renderer::SetDirectionalLight(s_Sun);
+        if (s_SunShadows) {
+            Groove::Renderer::SetShadowCaching(s_ShadowCaching);
+            Groove::Renderer::RenderShadows(*m_Camera, m_Transforms.data(), (uint32_t)m_Transforms.size(),
+                                            s_ShowStaticLevel && s_StaticBatch->IsBuilt() ? s_StaticBatch : nullptr);
+            const Groove::ShadowStats& shadowStats = Groove::Renderer::GetShadowStats();
+            int mode = s_ShadowCaching ? 1 : 0;
+            s_ShadowAvgDraws[mode] += 0.05f * ((float)shadowStats.DrawCalls - s_ShadowAvgDraws[mode]);
+            s_ShadowAvgCpuMs[mode] += 0.05f * (shadowStats.CullMs + shadowStats.SubmitMs - s_ShadowAvgCpuMs[mode]);
+            s_ShadowAvgGpuMs[mode] += 0.05f * (shadowStats.GpuMs - s_ShadowAvgGpuMs[mode]);
+        }
+        int sceneWidth = s_Window->GetWidth(), sceneHeight = s_Window->GetHeight();
+        if (s_DynamicResolutionEnabled) {
+            s_DynamicResolution->BeginFrame(sceneWidth, sceneHeight);
+            sceneWidth = (int)s_DynamicResolution->GetRenderWidth();
+            sceneHeight = (int)s_DynamicResolution->GetRenderHeight();
+        }
+        Groove::Renderer::BeginScene(*m_Camera, sceneWidth, sceneHeight);
+        // The resolution controller times only the scene passes: everything above is CPU work
+        // or resolution-independent shadow passes
+        if (s_DynamicResolutionEnabled)
+            s_DynamicResolution->BeginGpuTiming();
         glClearColor(0.1f, 0.1f, 0.1f, 1.0f); // Set a dark gray background
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-        // Animate both cubes (optional: rotate both)
-        m_Transforms[0].Rotation.y += deltaTime * 50.0f;
-        m_Transforms[1].Rotation.y -= deltaTime * 30.0f;
+        for (uint32_t i = 0; i < (uint32_t)m_Transforms.size(); i++)
+            Groove::Renderer::DrawCube(m_Transforms[i], *m_Camera, s_LODSelector.GetLOD(i));
 
-        Groove::Renderer::DrawCube(m_Transforms[0], *m_Camera);
-        Groove::Renderer::DrawCube(m_Transforms[1], *m_Camera);
+        float staticSubmitMs = 0.0f;
+        uint32_t drawCalls = (uint32_t)m_Transforms.size();
+        if (s_ShowStaticLevel) {
+            if (s_DrawStaticIndividually) {
+                double submitStart = glfwGetTime();
+                for (const auto& t : s_StaticLevel)
+                    Groove::Renderer::DrawCube(t, *m_Camera);
+                Groove::Renderer::FlushDraws(); // time the draws, not just the queueing
+                staticSubmitMs = (float)((glfwGetTime() - submitStart) * 1000.0);
+                drawCalls += (uint32_t)s_StaticLevel.size();
+            } else {
+                Groove::Renderer::DrawStaticBatch(*s_StaticBatch, *m_Camera);
+                staticSubmitMs = s_StaticBatch->GetStats().SubmitMs;
+                drawCalls += s_StaticBatch->GetStats().DrawCalls;
+            }
+        }
+
+        // Closes the lighting GPU timer, so only the opaque forward draws are measured
+        Groove::Renderer::EndScene();
+
+        // GPU picking: a 1x1 scissored ID pass at the cursor, read back a frame or two later.
+        // At most two draws (instanced cubes, static batch) however many objects there are.
+        if (s_PickBench.Active) {
+            StepPickBenchmark(m_Transforms, *m_Camera, *s_Window);
+        } else if (s_PickingBackend == (int)PickingBackend::GPUIDBuffer) {
+            if (leftMouseHeld && !s_MarqueeActive) {
+                double pickStart = glfwGetTime();
+                double mx, my;
+                Groove::Input::GetMousePosition(mx, my);
+                if (s_GPUPicker->BeginPass(mx, my, s_FrameIndex)) {
+                    DrawPickIDs(m_Transforms, *m_Camera);
+                    s_GPUPicker->EndPass();
+                    s_GPUPickObjectCount = (uint32_t)m_Transforms.size() + PickableStaticCount();
+                }
+                s_PickCpuMs = (float)((glfwGetTime() - pickStart) * 1000.0);
+            }
+        }
+        Groove::PickResult pick;
+        while (s_GPUPicker->PollResult(s_FrameIndex, pick)) {
+            if (s_PickBench.Active && s_PickBench.Resolved < s_PickBench.Submitted) {
+                ResolvePickBenchmark(pick);
+                continue;
+            }
+            s_LastGPUPick = pick;
+            RecordPickSample(PickingBackend::GPUIDBuffer, s_PickCpuMs, pick.LatencyMs, pick.FramesLatency,
+                             s_GPUPickObjectCount);
+            Groove::Metrics::Increment(s_MetricPicks);
+            Groove::Metrics::Observe(s_MetricPickLatency, pick.LatencyMs);
+            if (pick.Hit)
+                LogPickedObject(pick.EntityID);
+        }
+
+        // Transparent, so after all opaque geometry
+        if (s_Particles) {
+            s_Particles->Update(deltaTime, s_ParticleEmitter);
+            if (s_ParticlesCPU)
+                s_ParticlesCPU->Update(deltaTime, s_ParticleEmitter);
+            Groove::Renderer::DrawParticles(*s_Particles, *m_Camera, s_ParticleEmitter);
+            drawCalls++;
+        }
+
+        // Upscale into the window; ImGui below draws at native resolution
+        if (s_DynamicResolutionEnabled)
+            s_DynamicResolution->EndFrame();
 
         s_ImGuiLayer->Begin();
 
         ImGui::Begin("Groove Engine");
         ImGui::Text("Hello from ImGui!");
+        const Groove::LODSelectionStats& lodStats = s_LODSelector.GetStats();
+        ImGui::Separator();
+        ImGui::Text("LOD levels: %u", Groove::Renderer::GetCubeLODChain().GetLevelCount());
+        ImGui::Text("Triangles: %llu / %llu (saved %llu)",
+                    (unsigned long long)lodStats.TrianglesSelected,
+                    (unsigned long long)lodStats.TrianglesFullDetail,
+                    (unsigned long long)lodStats.GetTrianglesSaved());
+        ImGui::Text("LOD selection: %.3f ms for %u objects", lodStats.SelectionMs, lodStats.ObjectCount);
+        ImGui::SliderFloat("LOD pixel error", &s_LODSelector.Settings.PixelErrorThreshold, 0.25f, 16.0f);
+        bool lodStress = !s_LODStressTransforms.empty();
+        if (ImGui::Checkbox("LOD stress (100k objects, selection only)", &lodStress)) {
+            if (lodStress) {
+                BuildLODStress();
+            } else {
+                std::vector<Groove::Transform>().swap(s_LODStressTransforms);
+                s_LODStressSelector = Groove::LODSelector();
+            }
+        }
+        if (!s_LODStressTransforms.empty()) {
+            const Groove::LODSelectionStats& stressStats = s_LODStressSelector.GetStats();
+            ImGui::Text("Stress: %.3f ms for %u objects | triangles %llu / %llu (saved %llu)",
+                        stressStats.SelectionMs, stressStats.ObjectCount,
+                        (unsigned long long)stressStats.TrianglesSelected,
+                        (unsigned long long)stressStats.TrianglesFullDetail,
+                        (unsigned long long)stressStats.GetTrianglesSaved());
+        }
+        ImGui::Separator();
+        static const char* lightCountNames[] = { "16", "256", "1024" };
+        if (ImGui::Combo("Point lights", &s_LightCountIndex, lightCountNames, 3))
+            BuildLights(s_LightCountOptions[s_LightCountIndex]);
+        ImGui::Checkbox("Naive lighting (all lights per fragment)", &s_NaiveLighting);
+        const Groove::ClusterStats& lightStats = Groove::Renderer::GetLightingStats();
+        ImGui::Text("Forward pass GPU: %.3f ms | light culling: %.3f ms", lightStats.ShadingGpuMs, lightStats.CullMs);
+        ImGui::Text("Cluster light refs: %u (max %u per cluster)", lightStats.LightIndexCount, lightStats.MaxLightsInCluster);
+        ImGui::Text("Heap allocations last frame: %llu | steady frames that allocated: %llu",
+                    (unsigned long long)s_AllocationsLastFrame, (unsigned long long)s_AllocatingSteadyFrames);
+        ImGui::Separator();
+        static const char* pickingNames[] = { "Ray cast (CPU)", "ID buffer (GPU)" };
+        ImGui::Combo("Picking", &s_PickingBackend, pickingNames, 2);
+        ImGui::Text("Pick CPU cost: %.3f ms | pickable objects: %u", s_PickCpuMs,
+                    (uint32_t)m_Transforms.size() + PickableStaticCount());
+        if (s_PickingBackend == (int)PickingBackend::GPUIDBuffer)
+            ImGui::Text("Last GPU pick: %s #%u | %u frames / %.2f ms latency",
+                        s_LastGPUPick.Hit ? "hit" : "miss", s_LastGPUPick.EntityID,
+                        s_LastGPUPick.FramesLatency, s_LastGPUPick.LatencyMs);
+        // Last click of each backend; switch backends on the 1M static level to compare at scale
+        for (int backend = 0; backend < 2; backend++) {
+            const PickSample& sample = s_PickSamples[backend];
+            if (sample.Valid)
+                ImGui::Text("%s: %.3f ms CPU, %u frames / %.3f ms to result over %u objects",
+                            pickingNames[backend], sample.CpuMs, sample.FramesLatency, sample.LatencyMs,
+                            sample.ObjectCount);
+            else
+                ImGui::Text("%s: no pick yet", pickingNames[backend]);
+        }
+        if (s_PickBench.Active) {
+            ImGui::Text("Pick benchmark: %u/%u points", s_PickBench.Resolved, s_PickBenchPoints);
+        } else {
+            if (ImGui::Button("Run pick benchmark (6x6 points, both backends)")) {
+                s_PickBench = PickBenchmark();
+                s_PickBench.Active = true;
+            }
+            if (s_PickBench.Done)
+                ImGui::Text("Benchmark over %u objects: ray %.3f ms | ID %.3f ms CPU, %.1f frames | agree %u/%u",
+                            s_PickBench.ObjectCount, s_PickBench.RayMs / s_PickBenchPoints,
+                            s_PickBench.SubmitMs / s_PickBenchPoints, (double)s_PickBench.Frames / s_PickBenchPoints,
+                            s_PickBench.Agreed, s_PickBenchPoints);
+        }
+        ImGui::Separator();
+        if (ImGui::Checkbox("Static level", &s_ShowStaticLevel) && s_ShowStaticLevel && !s_StaticBatch->IsBuilt())
+            BuildStaticLevel();
+        static const char* staticLevelSizeNames[] = { "50k", "1M (picking comparison)" };
+        if (ImGui::Combo("Static level size", &s_StaticLevelSizeIndex, staticLevelSizeNames, 2) && s_StaticBatch->IsBuilt())
+            BuildStaticLevel();
+        ImGui::Checkbox("Draw static objects individually", &s_DrawStaticIndividually);
+        if (s_ShowStaticLevel) {
+            const Groove::StaticBatchStats& batchStats = s_StaticBatch->GetStats();
+            ImGui::Text("Static objects: %u | draw calls: %u (%s)", batchStats.ObjectCount,
+                        s_DrawStaticIndividually ? batchStats.ObjectCount : batchStats.DrawCalls,
+                        s_DrawStaticIndividually ? "individual" : "multi-draw");
+            ImGui::Text("Static submit: %.3f ms | batch build: %.1f ms", staticSubmitMs, batchStats.BuildMs);
+        }
+        ImGui::Separator();
+        ImGui::Checkbox("Sun shadows", &s_SunShadows);
+        ImGui::Checkbox("Cache static cascades", &s_ShadowCaching);
+        bool sunMoved = ImGui::SliderFloat("Sun yaw", &s_SunYaw, -180.0f, 180.0f);
+        sunMoved |= ImGui::SliderFloat("Sun pitch", &s_SunPitch, 10.0f, 89.0f);
+        if (sunMoved) {
+            float yaw = glm::radians(s_SunYaw), pitch = glm::radians(s_SunPitch);
+            s_Sun.Direction = glm::vec3(std::cos(pitch) * std::cos(yaw), -std::sin(pitch), std::cos(pitch) * std::sin(yaw));
+        }
+        if (s_SunShadows) {
+            const Groove::ShadowStats& shadowStats = Groove::Renderer::GetShadowStats();
+            ImGui::Text("Shadow cascades rendered: %u / %u | draw calls: %u", shadowStats.CascadesRendered,
+                        Groove::CascadedShadowMap::CascadeCount, shadowStats.DrawCalls);
+            ImGui::Text("Casters: %u dynamic, %u static, %u culled", shadowStats.DynamicCasters,
+                        shadowStats.StaticCasters, shadowStats.CulledCasters);
+            ImGui::Text("Shadow cull: %.3f ms | submit: %.3f ms | GPU: %.3f ms",
+                        shadowStats.CullMs, shadowStats.SubmitMs, shadowStats.GpuMs);
+            for (int mode = 1; mode >= 0; mode--)
+                ImGui::Text("  avg %s: %.1f draws | CPU %.3f ms | GPU %.3f ms", mode ? "cached  " : "uncached",
+                            s_ShadowAvgDraws[mode], s_ShadowAvgCpuMs[mode], s_ShadowAvgGpuMs[mode]);
+        }
+        ImGui::Separator();
+        static const char* broadphaseNames[] = { "Off", "10k", "100k" };
+        if (ImGui::Combo("Broadphase bodies", &s_BroadphaseCountIndex, broadphaseNames, 3))
+            BuildBroadphaseBodies(s_BroadphaseCountOptions[s_BroadphaseCountIndex]);
+        if (!s_BroadphaseBodies.empty()) {
+            const Groove::BroadphaseStats& bpStats = s_Broadphase.GetStats();
+            ImGui::Checkbox("Compare with brute force", &s_BroadphaseBruteForce);
+            ImGui::Text("SAP: %.3f ms | %u pairs | axis %c | %llu insertion swaps", bpStats.UpdateMs,
+                        bpStats.PairCount, "XYZ"[bpStats.SweepAxis], (unsigned long long)bpStats.InsertionSwaps);
+            if (s_BroadphaseBruteForce)
+                ImGui::Text(bpStats.ObjectCount <= (uint32_t)s_BruteForceMaxObjects
+                            ? "Brute force: %.3f ms" : "Brute force: skipped above 10k bodies", s_BruteForceMs);
+            if (bpStats.ObjectCount > (uint32_t)s_BruteForceMaxObjects && ImGui::Button("Time brute force once (stalls one frame)"))
+                s_BruteForceOneShotRequested = true;
+            if (s_BruteForceOneShotCount)
+                ImGui::Text("One-shot at %u bodies: brute force %.1f ms vs SAP %.3f ms", s_BruteForceOneShotCount,
+                            s_BruteForceOneShotMs, s_BruteForceOneShotSapMs);
+        }
+        ImGui::Separator();
+        static const char* presentModeNames[] = { "VSync", "Uncapped", "Frame limiter", "Low latency" };
+        int presentMode = (int)s_Window->GetPresentMode();
+        if (ImGui::Combo("Present mode", &presentMode, presentModeNames, 4))
+            s_Window->SetPresentMode((Groove::PresentMode)presentMode);
+        if (s_Window->GetPresentMode() == Groove::PresentMode::Limited) {
+            float targetFPS = (float)(1.0 / s_Window->GetTargetFrameTime());
+            if (ImGui::SliderFloat("Target FPS", &targetFPS, 30.0f, 240.0f))
+                s_Window->SetTargetFrameTime(1.0 / targetFPS);
+        }
+        const Groove::FrameStats& frameStats = s_Window->GetFrameStats();
+        ImGui::Text("Frame %.2f ms (min %.2f / max %.2f) | jitter %.3f ms", frameStats.FrameMs,
+                    frameStats.MinFrameMs, frameStats.MaxFrameMs, frameStats.JitterMs);
+        ImGui::Text("Work %.2f ms | pacing wait %.2f ms | est. input latency %.2f ms", frameStats.WorkMs,
+                    frameStats.WaitMs, frameStats.InputLatencyMs);
+        ImGui::Checkbox("Dynamic resolution", &s_DynamicResolutionEnabled);
+        if (s_DynamicResolutionEnabled) {
+            Groove::DynamicResolutionSettings& drSettings = s_DynamicResolution->Settings;
+            ImGui::SliderFloat("GPU budget", &drSettings.TargetFrameMs, 4.0f, 33.3f, "%.1f ms");
+            ImGui::SliderFloat("Min scale", &drSettings.MinScale, 0.25f, 1.0f);
+            ImGui::SliderFloat("Max scale", &drSettings.MaxScale, drSettings.MinScale, 1.0f);
+            ImGui::SliderFloat("Sharpness", &drSettings.Sharpness, 0.0f, 1.0f);
+            const Groove::DynamicResolutionStats& drStats = s_DynamicResolution->GetStats();
+            ImGui::Text("Scale %.2f (%ux%u) | GPU %.2f ms", drStats.Scale, drStats.RenderWidth,
+                        drStats.RenderHeight, drStats.GpuMs);
+        }
+        ImGui::Separator();
+        if (ImGui::Button("Save scene")) {
+            double start = glfwGetTime();
+            Groove::SaveScene(s_ScenePath, m_Transforms.data(), s_EntityNames.data(), (uint32_t)m_Transforms.size());
+            s_SceneIOMs = (float)((glfwGetTime() - start) * 1000.0);
+            s_SceneIOAction = "save";
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Save transforms (incremental)")) {
+            double start = glfwGetTime();
+            Groove::SaveSceneTransforms(s_ScenePath, m_Transforms.data(), (uint32_t)m_Transforms.size());
+            s_SceneIOMs = (float)((glfwGetTime() - start) * 1000.0);
+            s_SceneIOAction = "incremental save";
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Load scene")) {
+            double start = glfwGetTime();
+            LoadSceneFromFile();
+            s_SceneIOMs = (float)((glfwGetTime() - start) * 1000.0);
+            s_SceneIOAction = "load";
+        }
+        if (s_SceneIOAction[0])
+            ImGui::Text("Scene %s: %.3f ms (%u entities)", s_SceneIOAction, s_SceneIOMs, (uint32_t)m_Transforms.size());
+        if (ImGui::Button("Benchmark 1M-entity scene load"))
+            RunSceneBenchmark();
+        if (s_SceneBenchDone)
+            ImGui::Text("Read in place %.3f ms | binary copy-out %.1f ms | JSON %.1f ms",
+                        s_SceneBenchBinaryMapMs, s_SceneBenchBinaryLoadMs, s_SceneBenchJsonLoadMs);
+        ImGui::Separator();
+        ImGui::Text("Marquee (Shift + drag): %u selected in %.3f ms | grid: %u objects, %u cells",
+                    s_SelectionCount, s_MarqueeMs, s_SceneGrid.GetObjectCount(), s_SceneGrid.GetCellCount());
+        bool gridBench = s_GridBench != nullptr;
+        if (ImGui::Checkbox("Grid benchmark (1M objects, 10% moving)", &gridBench)) {
+            if (gridBench) {
+                BuildGridBench();
+            } else {
+                delete s_GridBench;
+                s_GridBench = nullptr;
+            }
+        }
+        if (s_GridBench) {
+            ImGui::Text("Move %u: %.3f ms (%.1f ns/object)", s_GridBenchCount / 10, s_GridMoveMs,
+                        s_GridMoveMs * 1.0e6f / (float)(s_GridBenchCount / 10));
+            ImGui::Text("Sphere r=10: %u in %.3f ms | 16 nearest: %.3f ms (farthest %.2f)",
+                        s_GridSphereCount, s_GridSphereMs, s_GridNearestMs, s_GridNearestDistance);
+        }
+        ImGui::Separator();
+        bool particles = s_Particles != nullptr;
+        if (ImGui::Checkbox("GPU particles (1M pool)", &particles)) {
+            Groove::MemoryTagScope memTag(Groove::MemTag::Renderer);
+            if (particles) {
+                s_Particles = new Groove::ParticleSystem(s_ParticleCapacity);
+            } else {
+                delete s_Particles;
+                delete s_ParticlesCPU;
+                s_Particles = nullptr;
+                s_ParticlesCPU = nullptr;
+            }
+        }
+        if (s_Particles) {
+            ImGui::SliderFloat("Emit rate", &s_ParticleEmitter.EmitRate, 0.0f, 500000.0f, "%.0f /s");
+            const Groove::ParticleStats& gpuStats = s_Particles->GetStats();
+            ImGui::Text("GPU: %u alive | %.3f ms | %.0f particles/ms", gpuStats.AliveCount, gpuStats.SimulateMs,
+                        gpuStats.ParticlesPerMs);
+            bool cpuReference = s_ParticlesCPU != nullptr;
+            if (ImGui::Checkbox("Run CPU reference alongside", &cpuReference)) {
+                Groove::MemoryTagScope memTag(Groove::MemTag::Renderer);
+                delete s_ParticlesCPU;
+                s_ParticlesCPU = cpuReference ? new Groove::ParticleSystemCPU(s_ParticleCapacity) : nullptr;
+            }
+            if (s_ParticlesCPU) {
+                const Groove::ParticleStats& cpuStats = s_ParticlesCPU->GetStats();
+                ImGui::Text("CPU: %u alive | %.3f ms | %.0f particles/ms", cpuStats.AliveCount, cpuStats.SimulateMs,
+                            cpuStats.ParticlesPerMs);
+            }
+        }
+        if (ImGui::Button("Validate particles against CPU reference")) {
+            Groove::MemoryTagScope memTag(Groove::MemTag::Renderer);
+            s_ParticleValidation = Groove::ParticleSystem::Validate(1u << 18, 120, 1.0f / 60.0f, s_ParticleEmitter);
+            s_ParticleValidated = true;
+        }
+        if (s_ParticleValidated)
+            ImGui::Text("%s: GPU %u / CPU %u alive | centroid error %.2e", s_ParticleValidation.Passed ? "Passed" : "FAILED",
+                        s_ParticleValidation.GpuAlive, s_ParticleValidation.CpuAlive, s_ParticleValidation.CentroidError);
+        ImGui::Separator();
+        static const char* batchMathPathNames[] = { "Scalar", "SSE", "AVX2" };
+        int batchMathPath = (int)Groove::BatchMath::GetPath();
+        if (ImGui::Combo("Batch math path", &batchMathPath, batchMathPathNames, (int)Groove::BatchMathPath::Count)) {
+            if (Groove::BatchMath::IsSupported((Groove::BatchMathPath)batchMathPath))
+                Groove::BatchMath::SetPath((Groove::BatchMathPath)batchMathPath);
+            else
+                Groove::Logger::Warning(Groove::Memory::GetFrameArena().Format("BatchMath: %s not supported on this CPU",
+                    batchMathPathNames[batchMathPath]));
+        }
+        if (ImGui::Button("Validate + benchmark batch math"))
+            RunBatchMathValidation();
+        if (s_BatchMathValidated) {
+            for (int path = 0; path < (int)Groove::BatchMathPath::Count; path++) {
+                if (!Groove::BatchMath::IsSupported((Groove::BatchMathPath)path))
+                    continue;
+                const Groove::BatchMathReport& r = s_BatchMathReports[path];
+                ImGui::TextColored(r.Passed ? ImVec4(0.4f, 1.0f, 0.4f, 1.0f) : ImVec4(1.0f, 0.3f, 0.3f, 1.0f),
+                                   "%-6s %s compose %6.1f | multiply %6.1f | AABB %6.1f M/s | max err %.1e",
+                                   batchMathPathNames[path], r.Passed ? "PASS" : "FAIL",
+                                   r.ComposeMPerSec, r.MultiplyMPerSec, r.AABBMPerSec,
+                                   std::max(std::max(r.ComposeError, r.MultiplyError), std::max(r.AABBError, r.SinCosError)));
+            }
+        }
         ImGui::End();
 
+        if (s_MarqueeActive)
+            ImGui::GetForegroundDrawList()->AddRect(ImVec2(s_MarqueeStart.x, s_MarqueeStart.y),
+                                                    ImVec2((float)cursorX, (float)cursorY), IM_COL32(255, 200, 0, 255));
+
+        DrawMemoryPanel();
+
+        // Widget clicks legitimately allocate (benchmarks, rebuilds), so they do not count as steady
+        const ImGuiIO& io = ImGui::GetIO();
+        bool steadyFrame = s_FrameIndex >= s_AllocationWarmupFrames && !io.WantTextInput &&
+                           !(io.WantCaptureMouse && (ImGui::IsMouseDown(0) || ImGui::IsMouseReleased(0)));
+
         s_ImGuiLayer->End();
 
         // Improved logging: log camera and cube info every second
         if (currentTime - logTimer >= 1.0f) {
             logTimer = currentTime;
-            std::ostringstream oss;
-            glm::vec3 cameraPosition(
-                m_Camera->GetViewMatrix()[3].x,
-                m_Camera->GetViewMatrix()[3].y,
-                m_Camera->GetViewMatrix()[3].z
-            );
-            oss << "Camera Position: " << Vec3ToString(cameraPosition)
-                << " | Yaw: " << m_Camera->GetYaw()
-                << " | Pitch: " << m_Camera->GetPitch()
-                << " | Camera Active: " << (rightMouseHeld ? "Yes" : "No");
-            Groove::Logger::Info(oss.str());
-            oss.str("");
-            oss << "Cube1 Rotation Y: " << m_Transforms[0].Rotation.y;
-            Groove::Logger::Info(oss.str());
-            oss.str("");
-            oss << "Cube2 Rotation Y: " << m_Transforms[1].Rotation.y;
-            Groove::Logger::Info(oss.str());
+            Groove::LinearArena& frameArena = Groove::Memory::GetFrameArena();
+            const glm::vec3& cameraPosition = m_Camera->GetPosition();
+            Groove::Logger::Info(frameArena.Format("Camera Position: (%g, %g, %g) | Yaw: %g | Pitch: %g | Camera Active: %s",
+                cameraPosition.x, cameraPosition.y, cameraPosition.z,
+                m_Camera->GetYaw(), m_Camera->GetPitch(), rightMouseHeld ? "Yes" : "No"));
+            if (m_Transforms.size() >= 2) {
+                Groove::Logger::Info(frameArena.Format("Cube1 Rotation Y: %g", m_Transforms[0].Rotation.y));
+                Groove::Logger::Info(frameArena.Format("Cube2 Rotation Y: %g", m_Transforms[1].Rotation.y));
+            }
+            Groove::Logger::Info(frameArena.Format("LOD: saved %llu of %llu triangles | selection %g ms",
+                (unsigned long long)lodStats.GetTrianglesSaved(), (unsigned long long)lodStats.TrianglesFullDetail,
+                lodStats.SelectionMs));
+            if (!s_LODStressTransforms.empty()) {
+                const Groove::LODSelectionStats& stressStats = s_LODStressSelector.GetStats();
+                Groove::Logger::Info(frameArena.Format("LOD stress: %u objects | selection %g ms | saved %llu of %llu triangles",
+                    stressStats.ObjectCount, stressStats.SelectionMs,
+                    (unsigned long long)stressStats.GetTrianglesSaved(), (unsigned long long)stressStats.TrianglesFullDetail));
+            }
+            Groove::Logger::Info(frameArena.Format("Lighting: %u lights (%s) | forward pass GPU %g ms | culling %g ms | max %u per cluster",
+                lightStats.LightCount, s_NaiveLighting ? "naive" : "clustered", lightStats.ShadingGpuMs, lightStats.CullMs,
+                lightStats.MaxLightsInCluster));
+            Groove::Logger::Info(frameArena.Format("Memory: %llu heap allocations last frame | frame arena high-water %zu bytes",
+                (unsigned long long)s_AllocationsLastFrame, frameArena.GetHighWater()));
+            Groove::Logger::Info(frameArena.Format("Frame pacing: %g ms mean | jitter %g ms | est. input latency %g ms",
+                frameStats.FrameMs, frameStats.JitterMs, frameStats.InputLatencyMs));
+            if (s_DynamicResolutionEnabled) {
+                const Groove::DynamicResolutionStats& drStats = s_DynamicResolution->GetStats();
+                Groove::Logger::Info(frameArena.Format("Dynamic resolution: scale %g (%ux%u) | GPU %g ms of %g ms budget | frame %g ms",
+                    drStats.Scale, drStats.RenderWidth, drStats.RenderHeight, drStats.GpuMs,
+                    s_DynamicResolution->Settings.TargetFrameMs, deltaTime * 1000.0f));
+            }
+            if (!s_BroadphaseBodies.empty()) {
+                const Groove::BroadphaseStats& bpStats = s_Broadphase.GetStats();
+                Groove::Logger::Info(frameArena.Format("Broadphase: %u bodies | %u pairs | SAP %g ms | brute force %g ms",
+                    bpStats.ObjectCount, bpStats.PairCount, bpStats.UpdateMs, s_BruteForceMs));
+                if (s_BruteForceOneShotCount)
+                    Groove::Logger::Info(frameArena.Format("Broadphase one-shot: %u bodies | brute force %g ms | SAP %g ms",
+                        s_BruteForceOneShotCount, s_BruteForceOneShotMs, s_BruteForceOneShotSapMs));
+            }
+            if (s_Particles) {
+                const Groove::ParticleStats& gpuStats = s_Particles->GetStats();
+                Groove::Logger::Info(frameArena.Format("Particles: %u alive | GPU %g ms (%g particles/ms) | CPU reference %g ms",
+                    gpuStats.AliveCount, gpuStats.SimulateMs, gpuStats.ParticlesPerMs,
+                    s_ParticlesCPU ? s_ParticlesCPU->GetStats().SimulateMs : 0.0f));
+            }
+            if (s_SunShadows) {
+                const Groove::ShadowStats& shadowStats = Groove::Renderer::GetShadowStats();
+                Groove::Logger::Info(frameArena.Format("Shadows (%s): %u cascades | %u draws | CPU %g ms | GPU %g ms",
+                    s_ShadowCaching ? "cached" : "uncached", shadowStats.CascadesRendered, shadowStats.DrawCalls,
+                    shadowStats.CullMs + shadowStats.SubmitMs, shadowStats.GpuMs));
+            }
+            if (s_GridBench)
+                Groove::Logger::Info(frameArena.Format("Spatial grid: moved %u of %u in %g ms | sphere query %g ms | 16-nearest %g ms",
+                    s_GridBenchCount / 10, s_GridBenchCount, s_GridMoveMs, s_GridSphereMs, s_GridNearestMs));
         }
 
         s_Window->OnUpdate();
+        s_FrameIndex++;
+
+        // Temporaries die with the frame
+        Groove::Memory::EndFrame();
+        Groove::MemoryTracker::EndFrame(glfwGetTime());
+        uint64_t allocationCount = Groove::Memory::GetAllocationCount();
+        s_AllocationsLastFrame = allocationCount - frameStartAllocations;
+        if (steadyFrame) {
+            s_SteadyFrames++;
+            s_SteadyFrameAllocations += s_AllocationsLastFrame;
+        }
+        if (steadyFrame && s_AllocationsLastFrame > 0) {
+            s_AllocatingSteadyFrames++;
+            if (currentTime - s_LastAllocationErrorTime >= 1.0f) {
+                s_LastAllocationErrorTime = currentTime;
+                Groove::Logger::Error(Groove::Memory::GetFrameArena().Format(
+                    "Steady-state frame %llu made %llu heap allocations (%llu such frames so far)",
+                    (unsigned long long)s_FrameIndex, (unsigned long long)s_AllocationsLastFrame,
+                    (unsigned long long)s_AllocatingSteadyFrames));
+            }
+        }
+
+        // Recording is a few relaxed stores; Publish copies them into the shared segment
+        const Groove::ShadowStats& shadowStats = Groove::Renderer::GetShadowStats();
+        Groove::Metrics::Increment(s_MetricFrames);
+        Groove::Metrics::Observe(s_MetricFrameTime, frameMs);
+        Groove::Metrics::SetGauge(s_MetricFrameWork, frameStats.WorkMs);
+        Groove::Metrics::SetGauge(s_MetricDrawCalls, drawCalls + (s_SunShadows ? shadowStats.DrawCalls : 0));
+        Groove::Metrics::SetGauge(s_MetricTriangles, (double)lodStats.TrianglesSelected);
+        Groove::Metrics::SetGauge(s_MetricShadowCasters,
+                                  s_SunShadows ? shadowStats.DynamicCasters + shadowStats.StaticCasters : 0);
+        Groove::Metrics::SetGauge(s_MetricShadowCulled, s_SunShadows ? shadowStats.CulledCasters : 0);
+        Groove::Metrics::SetGauge(s_MetricAllocations, (double)s_AllocationsLastFrame);
+        Groove::Metrics::SetGauge(s_MetricResolutionScale,
+                                  s_DynamicResolutionEnabled ? s_DynamicResolution->GetStats().Scale : 1.0f);
+        for (int i = 0; i < (int)Groove::MemTag::Count; i++) {
+            Groove::MemoryTagStats memStats = Groove::MemoryTracker::GetStats((Groove::MemTag)i);
+            Groove::Metrics::SetGauge(s_MetricCpuBytes[i], (double)memStats.CpuBytes);
+            Groove::Metrics::SetGauge(s_MetricGpuBytes[i], (double)memStats.GpuBytes);
+        }
+        Groove::Metrics::Publish(glfwGetTime());
+
+        if (s_TimingCsv) {
+            std::fprintf(s_TimingCsv, "%llu,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%llu\n",
+                (unsigned long long)s_FrameIndex, deltaTime * 1000.0f, frameMs, frameStats.WorkMs, frameStats.WaitMs,
+                lodStats.SelectionMs, lightStats.CullMs, (unsigned long long)s_AllocationsLastFrame);
+        }
+
+        if (s_AllocationCheckFrames && s_SteadyFrames >= s_AllocationCheckFrames) {
+            const char* result = Groove::Memory::GetFrameArena().Format(
+                "Allocation check: %llu heap allocations over %llu steady frames (%llu frames allocated)",
+                (unsigned long long)s_SteadyFrameAllocations, (unsigned long long)s_SteadyFrames,
+                (unsigned long long)s_AllocatingSteadyFrames);
+            if (s_SteadyFrameAllocations)
+                Groove::Logger::Error(result);
+            else
+                Groove::Logger::Info(result);
+            break;
+        }
     }
 }
 
+bool Engine::PassedAllocationCheck() {
+    return s_SteadyFrames >= s_AllocationCheckFrames && s_SteadyFrameAllocations == 0;
+}
+
 void Engine::Shutdown() {
+    Groove::Input::SetOverride(nullptr);
+    delete s_InputRecorder; // closes and patches the frame count
+    delete s_InputPlayer;
+    if (s_TimingCsv)
+        std::fclose(s_TimingCsv);
     s_ImGuiLayer->Shutdown();
     delete s_ImGuiLayer;
+    delete s_StaticBatch;
+    delete s_GridBench;
+    delete s_GPUPicker;
+    delete s_DynamicResolution;
+    delete s_Particles;
+    delete s_ParticlesCPU;
     Groove::Renderer::Shutdown();
     delete s_Window;
     delete m_Camera; // Clean up camera
+    Groove::JobSystem::Shutdown();
+    Groove::Metrics::Shutdown();
+    Groove::MemoryTracker::SetDumpFile(nullptr, 0.0f);
     Groove::Logger::Info("Shutdown complete.");
     Groove::Logger::Shutdown();
 }
\ No newline at end of file
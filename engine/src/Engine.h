@@ -1,7 +1,21 @@
-﻿#pragma once
+#pragma once
 
 namespace Engine {
-    void Init();
+    struct Config {
+        const char* RecordInputPath = nullptr;  // record input + frame timing to this file
+        const char* ReplayInputPath = nullptr;  // drive input + frame timing from this recording
+        const char* TimingCsvPath = nullptr;    // per-frame timings
+        const char* MetricsPrometheusPath = nullptr; // Prometheus textfile, rewritten every 5 s
+        bool Headless = false;                  // hidden window, uncapped presentation
+        unsigned int AllocationCheckFrames = 0; // > 0: enable the per-frame systems, run this many
+                                                // steady frames after warm-up, then leave Run
+    };
+
+    void Init(const Config& config = Config());
     void Run();
     void Shutdown();
+
+    // True when Config::AllocationCheckFrames steady frames (past warm-up, no UI interaction)
+    // ran without a single global operator new call
+    bool PassedAllocationCheck();
 }
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Camera.h"
+
+#include <glm/glm.hpp>
+
+namespace Groove {
+
+    // Six inward-facing planes (xyz = normal, w = distance): dot(n, p) + w >= 0 means inside
+    struct Frustum {
+        glm::vec4 Planes[6];
+
+        // Frustum of a sub-rectangle of the viewport in NDC ([-1, 1] on both axes), from a view-projection matrix
+        static Frustum FromNDCRect(const glm::mat4& viewProj, float x0, float y0, float x1, float y1) {
+            glm::vec4 row0(viewProj[0][0], viewProj[1][0], viewProj[2][0], viewProj[3][0]);
+            glm::vec4 row1(viewProj[0][1], viewProj[1][1], viewProj[2][1], viewProj[3][1]);
+            glm::vec4 row2(viewProj[0][2], viewProj[1][2], viewProj[2][2], viewProj[3][2]);
+            glm::vec4 row3(viewProj[0][3], viewProj[1][3], viewProj[2][3], viewProj[3][3]);
+
+            Frustum f;
+            f.Planes[0] = row0 - row3 * x0; // x >= x0 * w
+            f.Planes[1] = row3 * x1 - row0; // x <= x1 * w
+            f.Planes[2] = row1 - row3 * y0;
+            f.Planes[3] = row3 * y1 - row1;
+            f.Planes[4] = row3 + row2;      // near
+            f.Planes[5] = row3 - row2;      // far
+            for (int i = 0; i < 6; i++)
+                f.Planes[i] /= glm::length(glm::vec3(f.Planes[i]));
+            return f;
+        }
+
+        static Frustum FromCamera(const Camera& cam) {
+            return FromNDCRect(cam.GetProjectionMatrix() * cam.GetViewMatrix(), -1.0f, -1.0f, 1.0f, 1.0f);
+        }
+
+        // Marquee selection: a rectangle in window pixels (origin top-left, any corner order)
+        static Frustum FromScreenRect(const Camera& cam, float px0, float py0, float px1, float py1,
+                                      float viewportWidth, float viewportHeight) {
+            float x0 = 2.0f * glm::min(px0, px1) / viewportWidth - 1.0f;
+            float x1 = 2.0f * glm::max(px0, px1) / viewportWidth - 1.0f;
+            float y0 = 1.0f - 2.0f * glm::max(py0, py1) / viewportHeight;
+            float y1 = 1.0f - 2.0f * glm::min(py0, py1) / viewportHeight;
+            return FromNDCRect(cam.GetProjectionMatrix() * cam.GetViewMatrix(), x0, y0, x1, y1);
+        }
+
+        // Conservative: may accept boxes near the corners that are actually outside
+        bool IntersectsAABB(const glm::vec3& min, const glm::vec3& max) const {
+            for (int i = 0; i < 6; i++) {
+                const glm::vec4& p = Planes[i];
+                glm::vec3 positive(p.x >= 0.0f ? max.x : min.x,
+                                   p.y >= 0.0f ? max.y : min.y,
+                                   p.z >= 0.0f ? max.z : min.z);
+                if (p.x * positive.x + p.y * positive.y + p.z * positive.z + p.w < 0.0f)
+                    return false;
+            }
+            return true;
+        }
+    };
+
+} // namespace Groove
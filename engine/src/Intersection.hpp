@@ -1,6 +1,8 @@
 #pragma once
 
 #include <glm/glm.hpp>
+#include <cfloat>
+#include <utility>
 
 namespace Groove {
 
@@ -29,4 +31,11 @@ namespace Groove {
         return true;
     }
 
+    // Check if two AABBs overlap (touching counts as overlapping)
+    inline bool AABBIntersectsAABB(const glm::vec3& minA, const glm::vec3& maxA, const glm::vec3& minB, const glm::vec3& maxB) {
+        return minA.x <= maxB.x && maxA.x >= minB.x &&
+               minA.y <= maxB.y && maxA.y >= minB.y &&
+               minA.z <= maxB.z && maxA.z >= minB.z;
+    }
+
 } // namespace Groove
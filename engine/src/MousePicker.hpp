@@ -3,19 +3,19 @@
 #include <glm/glm.hpp>
 #include "Camera.h"
 #include "Window.h"
+#include "../Input/Input.h"
 
 namespace Groove {
 
     /**
-     * Generates a world-space ray from the camera through the current mouse position.
+     * Generates a world-space ray from the camera through a window position.
      * @param cam        Your camera (for view/proj matrices and position).
-     * @param window     Your Window wrapper (to read mouse coords and viewport size).
+     * @param window     Your Window wrapper (for the viewport size).
+     * @param mx, my     Window coords, top-left origin.
      * @return           A pair (origin, direction) in world space.
      */
-    static std::pair<glm::vec3, glm::vec3> CastRayFromMouse(Camera& cam, Window& window) {
+    static std::pair<glm::vec3, glm::vec3> CastRayFromScreen(Camera& cam, Window& window, double mx, double my) {
         // 1) Get normalized device coords
-        double mx, my;
-        window.GetNativeCursorPos(mx, my);
         int w = window.GetWidth(), h = window.GetHeight();
         float x = (2.0f * (float)mx) / w - 1.0f;
         float y = 1.0f - (2.0f * (float)my) / h;
@@ -37,4 +37,16 @@ namespace Groove {
         return { origin, ray_wor };
     }
 
+    /**
+     * Generates a world-space ray from the camera through the current mouse position.
+     * @param cam        Your camera (for view/proj matrices and position).
+     * @param window     Your Window wrapper (to read mouse coords and viewport size).
+     * @return           A pair (origin, direction) in world space.
+     */
+    static std::pair<glm::vec3, glm::vec3> CastRayFromMouse(Camera& cam, Window& window) {
+        double mx, my;
+        Input::GetMousePosition(mx, my); // honours input replay
+        return CastRayFromScreen(cam, window, mx, my);
+    }
+
 } // namespace Groove
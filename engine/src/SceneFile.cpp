@@ -0,0 +1,383 @@
+#include "SceneFile.h"
+#include "../Utils/Logger.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+
+namespace Groove {
+
+    static const char SceneMagic[4] = { 'G', 'S', 'C', 'N' };
+    static const uint16_t SceneVersionMajor = 1;
+    static const uint16_t SceneVersionMinor = 0;
+
+    static_assert(sizeof(SceneFileHeader) == 32, "SceneFileHeader layout changed");
+    static_assert(sizeof(SceneChunkEntry) == 32, "SceneChunkEntry layout changed");
+    static_assert(sizeof(Transform) == 36 && std::is_trivially_copyable<Transform>::value,
+                  "Transform is stored as raw bytes in scene files");
+
+    const uint64_t SceneWriter::ChunkAlignment;
+
+    // 64-bit file positions; long is 32 bits on Windows
+    static bool SeekTo(std::FILE* file, uint64_t offset, int origin) {
+#ifdef _WIN32
+        return _fseeki64(file, (__int64)offset, origin) == 0;
+#else
+        return fseeko(file, (off_t)offset, origin) == 0;
+#endif
+    }
+
+    static uint64_t Tell(std::FILE* file) {
+#ifdef _WIN32
+        return (uint64_t)_ftelli64(file);
+#else
+        return (uint64_t)ftello(file);
+#endif
+    }
+
+    SceneWriter::~SceneWriter() {
+        if (m_File)
+            Close();
+    }
+
+    bool SceneWriter::Open(const char* path) {
+        m_File = std::fopen(path, "wb");
+        if (!m_File) {
+            Logger::Error("SceneWriter: could not create scene file");
+            return false;
+        }
+        // Placeholder header, rewritten by Close
+        SceneFileHeader header{};
+        std::fwrite(&header, sizeof(header), 1, m_File);
+        m_Offset = sizeof(header);
+        m_Chunks.clear();
+        return true;
+    }
+
+    bool SceneWriter::OpenAppend(const char* path) {
+        m_File = std::fopen(path, "r+b");
+        if (!m_File)
+            return Open(path);
+
+        SceneFileHeader header{};
+        if (std::fread(&header, sizeof(header), 1, m_File) != 1 || std::memcmp(header.Magic, SceneMagic, 4) != 0 ||
+            header.VersionMajor != SceneVersionMajor) {
+            Logger::Error("SceneWriter: cannot append to an incompatible scene file");
+            std::fclose(m_File);
+            m_File = nullptr;
+            return false;
+        }
+        m_Chunks.resize(header.ChunkCount);
+        if (!SeekTo(m_File, header.ChunkTableOffset, SEEK_SET) ||
+            (header.ChunkCount && std::fread(m_Chunks.data(), sizeof(SceneChunkEntry), header.ChunkCount, m_File) != header.ChunkCount)) {
+            Logger::Error("SceneWriter: scene file chunk table is truncated");
+            std::fclose(m_File);
+            m_File = nullptr;
+            return false;
+        }
+
+        // Append after the old table so the file stays valid until the new header lands
+        SeekTo(m_File, 0, SEEK_END);
+        m_Offset = Tell(m_File);
+        return true;
+    }
+
+    void SceneWriter::Pad() {
+        static const uint8_t zeros[ChunkAlignment] = {};
+        uint64_t padding = (ChunkAlignment - m_Offset % ChunkAlignment) % ChunkAlignment;
+        std::fwrite(zeros, 1, (size_t)padding, m_File);
+        m_Offset += padding;
+    }
+
+    void SceneWriter::BeginChunk(uint32_t tag, uint32_t elementSize) {
+        Pad();
+        m_Current = SceneChunkEntry{ tag, elementSize, 0, m_Offset, 0 };
+        m_InChunk = true;
+    }
+
+    void SceneWriter::Write(const void* elements, uint64_t count) {
+        uint64_t bytes = count * m_Current.ElementSize;
+        std::fwrite(elements, 1, (size_t)bytes, m_File);
+        m_Current.ElementCount += count;
+        m_Current.Size += bytes;
+        m_Offset += bytes;
+    }
+
+    void SceneWriter::EndChunk() {
+        m_InChunk = false;
+        for (SceneChunkEntry& chunk : m_Chunks) {
+            if (chunk.Tag == m_Current.Tag) {
+                chunk = m_Current;
+                return;
+            }
+        }
+        m_Chunks.push_back(m_Current);
+    }
+
+    void SceneWriter::WriteChunk(uint32_t tag, const void* elements, uint32_t elementSize, uint64_t count) {
+        BeginChunk(tag, elementSize);
+        Write(elements, count);
+        EndChunk();
+    }
+
+    const SceneChunkEntry* SceneWriter::FindChunk(uint32_t tag) const {
+        for (const SceneChunkEntry& chunk : m_Chunks) {
+            if (chunk.Tag == tag)
+                return &chunk;
+        }
+        return nullptr;
+    }
+
+    void SceneWriter::RemoveChunk(uint32_t tag) {
+        for (size_t i = 0; i < m_Chunks.size(); i++) {
+            if (m_Chunks[i].Tag == tag) {
+                m_Chunks.erase(m_Chunks.begin() + i);
+                return;
+            }
+        }
+    }
+
+    bool SceneWriter::Close() {
+        if (!m_File)
+            return false;
+        if (m_InChunk)
+            EndChunk();
+
+        Pad();
+        SceneFileHeader header{};
+        std::memcpy(header.Magic, SceneMagic, 4);
+        header.VersionMajor = SceneVersionMajor;
+        header.VersionMinor = SceneVersionMinor;
+        header.ChunkCount = (uint32_t)m_Chunks.size();
+        header.ChunkTableOffset = m_Offset;
+        header.FileSize = m_Offset + m_Chunks.size() * sizeof(SceneChunkEntry);
+        std::fwrite(m_Chunks.data(), sizeof(SceneChunkEntry), m_Chunks.size(), m_File);
+
+        // Header last: until here an appended file still points at its previous table
+        std::fflush(m_File);
+        std::fseek(m_File, 0, SEEK_SET);
+        std::fwrite(&header, sizeof(header), 1, m_File);
+        bool ok = std::ferror(m_File) == 0;
+        std::fclose(m_File);
+        m_File = nullptr;
+        if (!ok)
+            Logger::Error("SceneWriter: write failed");
+        return ok;
+    }
+
+    bool SceneReader::Open(const char* path) {
+        Close();
+        if (!m_File.Open(path))
+            return false;
+
+        const uint8_t* data = m_File.GetData();
+        const size_t size = m_File.GetSize();
+        const SceneFileHeader* header = reinterpret_cast<const SceneFileHeader*>(data);
+        if (size < sizeof(SceneFileHeader) || std::memcmp(header->Magic, SceneMagic, 4) != 0) {
+            Logger::Error("SceneReader: not a scene file");
+            Close();
+            return false;
+        }
+        if (header->VersionMajor != SceneVersionMajor) {
+            Logger::Error("SceneReader: unsupported scene file version");
+            Close();
+            return false;
+        }
+        // Checks are written so nothing a crafted file stores can wrap around in uint64
+        if (header->FileSize > size || header->ChunkTableOffset > size ||
+            header->ChunkCount > (size - header->ChunkTableOffset) / sizeof(SceneChunkEntry)) {
+            Logger::Error("SceneReader: scene file is truncated");
+            Close();
+            return false;
+        }
+        // The table and the payloads are used in place, so they must be aligned for their types
+        if (header->ChunkTableOffset % alignof(SceneChunkEntry) != 0) {
+            Logger::Error("SceneReader: scene file chunk table is misaligned");
+            Close();
+            return false;
+        }
+
+        const SceneChunkEntry* chunks = reinterpret_cast<const SceneChunkEntry*>(data + header->ChunkTableOffset);
+        for (uint32_t i = 0; i < header->ChunkCount; i++) {
+            const SceneChunkEntry& chunk = chunks[i];
+            bool inBounds = chunk.Offset <= size && chunk.Size <= size - chunk.Offset;
+            bool sizeMatches = chunk.ElementSize != 0 ? chunk.ElementCount <= chunk.Size / chunk.ElementSize &&
+                                                        chunk.ElementCount * chunk.ElementSize == chunk.Size
+                                                      : chunk.Size == 0;
+            if (!inBounds || !sizeMatches || chunk.Offset % SceneWriter::ChunkAlignment != 0) {
+                Logger::Error("SceneReader: scene file has a corrupt chunk");
+                Close();
+                return false;
+            }
+        }
+
+        m_Header = header;
+        m_Chunks = chunks;
+        if (const SceneChunkEntry* strings = FindChunk(SceneChunk::Strings)) {
+            m_Strings = reinterpret_cast<const char*>(data + strings->Offset);
+            m_StringsSize = strings->Size;
+        }
+        return true;
+    }
+
+    void SceneReader::Close() {
+        m_File.Close();
+        m_Header = nullptr;
+        m_Chunks = nullptr;
+        m_Strings = nullptr;
+        m_StringsSize = 0;
+    }
+
+    const SceneChunkEntry* SceneReader::FindChunk(uint32_t tag) const {
+        if (!m_Header)
+            return nullptr;
+        for (uint32_t i = 0; i < m_Header->ChunkCount; i++) {
+            if (m_Chunks[i].Tag == tag)
+                return &m_Chunks[i];
+        }
+        return nullptr;
+    }
+
+    const char* SceneReader::GetString(uint32_t offset) const {
+        if (!m_Strings || offset >= m_StringsSize || m_Strings[m_StringsSize - 1] != '\0')
+            return "";
+        return m_Strings + offset;
+    }
+
+    uint64_t SceneReader::GetDeadBytes() const {
+        if (!m_Header)
+            return 0;
+        uint64_t live = sizeof(SceneFileHeader) + m_Header->ChunkCount * sizeof(SceneChunkEntry);
+        for (uint32_t i = 0; i < m_Header->ChunkCount; i++)
+            live += m_Chunks[i].Size;
+        return m_Header->FileSize > live ? m_Header->FileSize - live : 0;
+    }
+
+    bool SaveScene(const char* path, const Transform* transforms, const std::string* names, uint32_t count) {
+        SceneWriter writer;
+        if (!writer.Open(path))
+            return false;
+
+        writer.WriteChunk(SceneChunk::Transforms, transforms, sizeof(Transform), count);
+
+        if (names) {
+            // Offsets first (known up front), then the strings they point into
+            writer.BeginChunk(SceneChunk::Names, sizeof(uint32_t));
+            uint32_t offset = 0;
+            for (uint32_t i = 0; i < count; i++) {
+                writer.Write(&offset, 1);
+                offset += (uint32_t)names[i].size() + 1;
+            }
+            writer.EndChunk();
+
+            writer.BeginChunk(SceneChunk::Strings, 1);
+            for (uint32_t i = 0; i < count; i++)
+                writer.Write(names[i].c_str(), names[i].size() + 1);
+            writer.EndChunk();
+        }
+        return writer.Close();
+    }
+
+    bool SaveSceneTransforms(const char* path, const Transform* transforms, uint32_t count) {
+        SceneWriter writer;
+        if (!writer.OpenAppend(path))
+            return false;
+        writer.WriteChunk(SceneChunk::Transforms, transforms, sizeof(Transform), count);
+        const SceneChunkEntry* names = writer.FindChunk(SceneChunk::Names);
+        if (names && names->ElementCount != count) {
+            Logger::Warning("SaveSceneTransforms: entity count changed, dropping the stale names");
+            writer.RemoveChunk(SceneChunk::Names);
+            writer.RemoveChunk(SceneChunk::Strings);
+        }
+        return writer.Close();
+    }
+
+    bool LoadScene(const char* path, SceneData& out) {
+        SceneReader reader;
+        if (!reader.Open(path))
+            return false;
+
+        uint64_t count = 0;
+        const Transform* transforms = reader.GetArray<Transform>(SceneChunk::Transforms, count);
+        out.Transforms.assign(transforms, transforms + count);
+
+        uint64_t nameCount = 0;
+        const uint32_t* names = reader.GetArray<uint32_t>(SceneChunk::Names, nameCount);
+        out.Names.assign((size_t)count, std::string());
+        for (uint64_t i = 0; i < count && i < nameCount; i++)
+            out.Names[(size_t)i] = reader.GetString(names[i]);
+        return true;
+    }
+
+    bool SaveSceneJson(const char* path, const Transform* transforms, const std::string* names, uint32_t count) {
+        std::FILE* file = std::fopen(path, "w");
+        if (!file) {
+            Logger::Error("SaveSceneJson: could not create file");
+            return false;
+        }
+        std::fprintf(file, "{\"entities\":[\n");
+        for (uint32_t i = 0; i < count; i++) {
+            const Transform& t = transforms[i];
+            std::fprintf(file, "{\"name\":\"%s\",\"position\":[%.9g,%.9g,%.9g],\"rotation\":[%.9g,%.9g,%.9g],\"scale\":[%.9g,%.9g,%.9g]}%s\n",
+                names ? names[i].c_str() : "",
+                t.Position.x, t.Position.y, t.Position.z, t.Rotation.x, t.Rotation.y, t.Rotation.z,
+                t.Scale.x, t.Scale.y, t.Scale.z, i + 1 < count ? "," : "");
+        }
+        std::fprintf(file, "]}\n");
+        std::fclose(file);
+        return true;
+    }
+
+    // Reads the next "key":[x,y,z] triple after p
+    static const char* ReadVec3(const char* p, const char* key, glm::vec3& out) {
+        p = std::strstr(p, key);
+        if (!p)
+            return nullptr;
+        p = std::strchr(p, '[');
+        if (!p)
+            return nullptr;
+        char* end = nullptr;
+        out.x = std::strtof(p + 1, &end);
+        out.y = std::strtof(end + 1, &end);
+        out.z = std::strtof(end + 1, &end);
+        return end;
+    }
+
+    bool LoadSceneJson(const char* path, SceneData& out) {
+        std::FILE* file = std::fopen(path, "rb");
+        if (!file) {
+            Logger::Error("LoadSceneJson: could not open file");
+            return false;
+        }
+        SeekTo(file, 0, SEEK_END);
+        uint64_t size = Tell(file);
+        SeekTo(file, 0, SEEK_SET);
+        std::string text(size == (uint64_t)-1 ? 0 : (size_t)size, '\0');
+        size_t read = std::fread(&text[0], 1, text.size(), file);
+        std::fclose(file);
+        text.resize(read);
+
+        out.Transforms.clear();
+        out.Names.clear();
+        const char* p = text.c_str();
+        while ((p = std::strstr(p, "{\"name\":\"")) != nullptr) {
+            p += 9;
+            const char* nameEnd = std::strchr(p, '"');
+            if (!nameEnd)
+                return false;
+            out.Names.emplace_back(p, nameEnd);
+
+            Transform t;
+            p = ReadVec3(nameEnd, "\"position\"", t.Position);
+            if (p) p = ReadVec3(p, "\"rotation\"", t.Rotation);
+            if (p) p = ReadVec3(p, "\"scale\"", t.Scale);
+            if (!p) {
+                Logger::Error("LoadSceneJson: malformed entity");
+                return false;
+            }
+            out.Transforms.push_back(t);
+        }
+        return true;
+    }
+
+}
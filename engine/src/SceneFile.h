@@ -0,0 +1,137 @@
+#pragma once
+
+#include "Transform.h"
+#include "../Utils/MappedFile.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace Groove {
+
+    constexpr uint32_t MakeChunkTag(char a, char b, char c, char d) {
+        return (uint32_t)(uint8_t)a | ((uint32_t)(uint8_t)b << 8) | ((uint32_t)(uint8_t)c << 16) | ((uint32_t)(uint8_t)d << 24);
+    }
+
+    // Chunks written by SaveScene; other tags are skipped by readers that do not know them
+    namespace SceneChunk {
+        const uint32_t Transforms = MakeChunkTag('T', 'R', 'F', 'M'); // Transform per entity
+        const uint32_t Names      = MakeChunkTag('N', 'A', 'M', 'E'); // uint32 string offset per entity
+        const uint32_t Strings    = MakeChunkTag('S', 'T', 'R', 'S'); // NUL-terminated strings
+    }
+
+    // Scene file layout (.gscn, little endian):
+    //   SceneFileHeader at offset 0
+    //   chunk payloads, each starting on a ChunkAlignment boundary
+    //   SceneChunkEntry table at ChunkTableOffset
+    // Every offset is relative to the start of the file, so a read-only mapping is usable in
+    // place wherever it lands. Incremental saves append chunks and a new table; the newest
+    // table wins and the data it no longer references is dead until the next full save.
+    struct SceneFileHeader {
+        char     Magic[4];          // "GSCN"
+        uint16_t VersionMajor;      // readers reject other majors
+        uint16_t VersionMinor;      // new minors only add chunk types
+        uint32_t ChunkCount;
+        uint32_t Reserved;
+        uint64_t ChunkTableOffset;
+        uint64_t FileSize;
+    };
+
+    struct SceneChunkEntry {
+        uint32_t Tag;
+        uint32_t ElementSize;
+        uint64_t ElementCount;
+        uint64_t Offset;
+        uint64_t Size;
+    };
+
+    // Streams chunks straight to disk, so a scene never has to exist twice in memory
+    class SceneWriter {
+    public:
+        static const uint64_t ChunkAlignment = 64;
+
+        ~SceneWriter();
+
+        bool Open(const char* path);
+        // Incremental save: keeps the file's chunks, chunks written now replace those with the same tag
+        bool OpenAppend(const char* path);
+
+        void BeginChunk(uint32_t tag, uint32_t elementSize);
+        void Write(const void* elements, uint64_t count);
+        void EndChunk();
+        void WriteChunk(uint32_t tag, const void* elements, uint32_t elementSize, uint64_t count);
+
+        // Chunks the next table will list (for appends, the file's chunks plus those written since)
+        const SceneChunkEntry* FindChunk(uint32_t tag) const;
+        // Leaves a chunk out of the next table; its bytes become dead space
+        void RemoveChunk(uint32_t tag);
+
+        // Writes the chunk table and header; the file is only valid after this
+        bool Close();
+
+    private:
+        void Pad();
+
+        std::FILE* m_File = nullptr;
+        uint64_t m_Offset = 0;
+        std::vector<SceneChunkEntry> m_Chunks;
+        SceneChunkEntry m_Current{};
+        bool m_InChunk = false;
+    };
+
+    // Maps a scene file and hands out pointers into the mapping, no copies
+    class SceneReader {
+    public:
+        bool Open(const char* path);
+        void Close();
+
+        const SceneChunkEntry* FindChunk(uint32_t tag) const;
+
+        // In-place array view; nullptr if missing or the element size does not match T.
+        // Open only accepts chunks on ChunkAlignment boundaries, so T needs no stricter alignment.
+        template<typename T>
+        const T* GetArray(uint32_t tag, uint64_t& outCount) const {
+            static_assert(alignof(T) <= SceneWriter::ChunkAlignment, "chunk payloads are only ChunkAlignment aligned");
+            const SceneChunkEntry* chunk = FindChunk(tag);
+            if (!chunk || chunk->ElementSize != sizeof(T)) {
+                outCount = 0;
+                return nullptr;
+            }
+            outCount = chunk->ElementCount;
+            return reinterpret_cast<const T*>(m_File.GetData() + chunk->Offset);
+        }
+
+        // String from the string table ("" for bad offsets)
+        const char* GetString(uint32_t offset) const;
+
+        const SceneFileHeader& GetHeader() const { return *m_Header; }
+        // Bytes left behind by incremental saves
+        uint64_t GetDeadBytes() const;
+
+    private:
+        MappedFile m_File;
+        const SceneFileHeader* m_Header = nullptr;
+        const SceneChunkEntry* m_Chunks = nullptr;
+        const char* m_Strings = nullptr;
+        uint64_t m_StringsSize = 0;
+    };
+
+    // Copied-out scene contents, parallel arrays indexed by entity
+    struct SceneData {
+        std::vector<Transform> Transforms;
+        std::vector<std::string> Names;
+    };
+
+    // Full save: transforms, names (may be nullptr) and the string table
+    bool SaveScene(const char* path, const Transform* transforms, const std::string* names, uint32_t count);
+    // Incremental save that only rewrites the transforms chunk. Names are kept while the entity
+    // count matches; otherwise they no longer line up and are dropped.
+    bool SaveSceneTransforms(const char* path, const Transform* transforms, uint32_t count);
+    bool LoadScene(const char* path, SceneData& out);
+
+    // JSON baseline for load-time comparisons (minimal hand-written reader, not a general parser)
+    bool SaveSceneJson(const char* path, const Transform* transforms, const std::string* names, uint32_t count);
+    bool LoadSceneJson(const char* path, SceneData& out);
+
+}
@@ -0,0 +1,345 @@
+#include "SpatialHashGrid.h"
+#include "Frustum.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+namespace Groove {
+
+    const uint32_t SpatialHashGrid::InvalidHandle;
+
+    static uint32_t HashCell(int32_t x, int32_t y, int32_t z) {
+        return ((uint32_t)x * 73856093u) ^ ((uint32_t)y * 19349663u) ^ ((uint32_t)z * 83492791u);
+    }
+
+    // Squared distance from a point to an AABB (0 inside)
+    static float DistanceSqToAABB(const glm::vec3& p, const glm::vec3& min, const glm::vec3& max) {
+        float d = 0.0f;
+        for (int axis = 0; axis < 3; axis++) {
+            float v = p[axis] < min[axis] ? min[axis] - p[axis] : (p[axis] > max[axis] ? p[axis] - max[axis] : 0.0f);
+            d += v * v;
+        }
+        return d;
+    }
+
+    // Corner shared by three planes
+    static glm::vec3 IntersectPlanes(const glm::vec4& a, const glm::vec4& b, const glm::vec4& c) {
+        glm::vec3 na(a), nb(b), nc(c);
+        glm::vec3 bc = glm::cross(nb, nc);
+        float denom = glm::dot(na, bc);
+        return (bc * -a.w - glm::cross(nc, na) * b.w - glm::cross(na, nb) * c.w) / denom;
+    }
+
+    SpatialHashGrid::SpatialHashGrid(float cellSize)
+        : m_CellSize(cellSize), m_InvCellSize(1.0f / cellSize) {
+        Clear();
+    }
+
+    void SpatialHashGrid::Clear() {
+        m_Objects.clear();
+        m_FreeList = InvalidHandle;
+        m_ObjectCount = 0;
+        m_Cells.clear();
+        m_Table.assign(64, InvalidHandle);
+        m_MaxHalfExtent = glm::vec3(0.0f);
+        for (int axis = 0; axis < 3; axis++) {
+            m_BoundsMin[axis] = INT_MAX;
+            m_BoundsMax[axis] = INT_MIN;
+        }
+    }
+
+    void SpatialHashGrid::Reserve(uint32_t objectCount) {
+        m_Objects.reserve(objectCount);
+    }
+
+    void SpatialHashGrid::CellCoords(const glm::vec3& p, int32_t& x, int32_t& y, int32_t& z) const {
+        x = (int32_t)std::floor(p.x * m_InvCellSize);
+        y = (int32_t)std::floor(p.y * m_InvCellSize);
+        z = (int32_t)std::floor(p.z * m_InvCellSize);
+    }
+
+    uint32_t SpatialHashGrid::FindCell(int32_t x, int32_t y, int32_t z) const {
+        const uint32_t mask = (uint32_t)m_Table.size() - 1;
+        for (uint32_t i = HashCell(x, y, z) & mask;; i = (i + 1) & mask) {
+            uint32_t cell = m_Table[i];
+            if (cell == InvalidHandle)
+                return InvalidHandle;
+            const Cell& c = m_Cells[cell];
+            if (c.X == x && c.Y == y && c.Z == z)
+                return cell;
+        }
+    }
+
+    // Cells are never removed, an emptied cell is simply skipped by queries and reused later
+    uint32_t SpatialHashGrid::FindOrCreateCell(int32_t x, int32_t y, int32_t z) {
+        uint32_t cell = FindCell(x, y, z);
+        if (cell != InvalidHandle)
+            return cell;
+
+        if ((m_Cells.size() + 1) * 2 > m_Table.size())
+            Rehash((uint32_t)m_Table.size() * 2);
+
+        cell = (uint32_t)m_Cells.size();
+        m_Cells.push_back(Cell{ x, y, z, std::vector<uint32_t>() });
+
+        const uint32_t mask = (uint32_t)m_Table.size() - 1;
+        uint32_t i = HashCell(x, y, z) & mask;
+        while (m_Table[i] != InvalidHandle)
+            i = (i + 1) & mask;
+        m_Table[i] = cell;
+
+        const int32_t coords[3] = { x, y, z };
+        for (int axis = 0; axis < 3; axis++) {
+            m_BoundsMin[axis] = std::min(m_BoundsMin[axis], coords[axis]);
+            m_BoundsMax[axis] = std::max(m_BoundsMax[axis], coords[axis]);
+        }
+        return cell;
+    }
+
+    void SpatialHashGrid::Rehash(uint32_t tableSize) {
+        m_Table.assign(tableSize, InvalidHandle);
+        const uint32_t mask = tableSize - 1;
+        for (uint32_t cell = 0; cell < (uint32_t)m_Cells.size(); cell++) {
+            const Cell& c = m_Cells[cell];
+            uint32_t i = HashCell(c.X, c.Y, c.Z) & mask;
+            while (m_Table[i] != InvalidHandle)
+                i = (i + 1) & mask;
+            m_Table[i] = cell;
+        }
+    }
+
+    void SpatialHashGrid::AddToCell(uint32_t handle, uint32_t cell) {
+        Object& o = m_Objects[handle];
+        std::vector<uint32_t>& list = m_Cells[cell].Objects;
+        o.Cell = cell;
+        o.Slot = (uint32_t)list.size();
+        list.push_back(handle);
+    }
+
+    void SpatialHashGrid::RemoveFromCell(uint32_t handle) {
+        const Object& o = m_Objects[handle];
+        std::vector<uint32_t>& list = m_Cells[o.Cell].Objects;
+        uint32_t last = list.back();
+        list[o.Slot] = last;
+        m_Objects[last].Slot = o.Slot;
+        list.pop_back();
+    }
+
+    uint32_t SpatialHashGrid::Insert(const glm::vec3& min, const glm::vec3& max) {
+        uint32_t handle;
+        if (m_FreeList != InvalidHandle) {
+            handle = m_FreeList;
+            m_FreeList = m_Objects[handle].Slot;
+        } else {
+            handle = (uint32_t)m_Objects.size();
+            m_Objects.push_back(Object());
+        }
+
+        Object& o = m_Objects[handle];
+        o.Min = min;
+        o.Max = max;
+        m_MaxHalfExtent = glm::max(m_MaxHalfExtent, (max - min) * 0.5f);
+
+        int32_t x, y, z;
+        CellCoords((min + max) * 0.5f, x, y, z);
+        AddToCell(handle, FindOrCreateCell(x, y, z));
+        m_ObjectCount++;
+        return handle;
+    }
+
+    void SpatialHashGrid::Move(uint32_t handle, const glm::vec3& min, const glm::vec3& max) {
+        Object& o = m_Objects[handle];
+        o.Min = min;
+        o.Max = max;
+        m_MaxHalfExtent = glm::max(m_MaxHalfExtent, (max - min) * 0.5f);
+
+        int32_t x, y, z;
+        CellCoords((min + max) * 0.5f, x, y, z);
+        const Cell& current = m_Cells[o.Cell];
+        if (current.X == x && current.Y == y && current.Z == z)
+            return;
+
+        RemoveFromCell(handle);
+        AddToCell(handle, FindOrCreateCell(x, y, z));
+    }
+
+    void SpatialHashGrid::Remove(uint32_t handle) {
+        RemoveFromCell(handle);
+        Object& o = m_Objects[handle];
+        o.Cell = InvalidHandle;
+        o.Slot = m_FreeList;
+        m_FreeList = handle;
+        m_ObjectCount--;
+    }
+
+    template<typename Fn>
+    void SpatialHashGrid::ForEachCell(const glm::vec3& min, const glm::vec3& max, Fn fn) const {
+        if (m_ObjectCount == 0)
+            return;
+
+        // An object overlapping [min, max] has its centre within the box grown by the largest half extent
+        int32_t lo[3], hi[3];
+        CellCoords(min - m_MaxHalfExtent, lo[0], lo[1], lo[2]);
+        CellCoords(max + m_MaxHalfExtent, hi[0], hi[1], hi[2]);
+        uint64_t rangeCells = 1;
+        for (int axis = 0; axis < 3; axis++) {
+            lo[axis] = std::max(lo[axis], m_BoundsMin[axis]);
+            hi[axis] = std::min(hi[axis], m_BoundsMax[axis]);
+            if (lo[axis] > hi[axis])
+                return;
+            rangeCells *= (uint64_t)(hi[axis] - lo[axis] + 1);
+        }
+
+        // Big ranges: walking the cell list beats hashing every coordinate
+        if (rangeCells > m_Cells.size()) {
+            for (uint32_t cell = 0; cell < (uint32_t)m_Cells.size(); cell++) {
+                const Cell& c = m_Cells[cell];
+                if (!c.Objects.empty() &&
+                    c.X >= lo[0] && c.X <= hi[0] && c.Y >= lo[1] && c.Y <= hi[1] && c.Z >= lo[2] && c.Z <= hi[2])
+                    fn(c);
+            }
+            return;
+        }
+
+        for (int32_t z = lo[2]; z <= hi[2]; z++) {
+            for (int32_t y = lo[1]; y <= hi[1]; y++) {
+                for (int32_t x = lo[0]; x <= hi[0]; x++) {
+                    uint32_t cell = FindCell(x, y, z);
+                    if (cell != InvalidHandle && !m_Cells[cell].Objects.empty())
+                        fn(m_Cells[cell]);
+                }
+            }
+        }
+    }
+
+    uint32_t SpatialHashGrid::QueryAABB(const glm::vec3& min, const glm::vec3& max, uint32_t* outHandles, uint32_t capacity) const {
+        uint32_t found = 0;
+        ForEachCell(min, max, [&](const Cell& c) {
+            for (uint32_t handle : c.Objects) {
+                const Object& o = m_Objects[handle];
+                if (o.Min.x <= max.x && o.Max.x >= min.x && o.Min.y <= max.y && o.Max.y >= min.y &&
+                    o.Min.z <= max.z && o.Max.z >= min.z) {
+                    if (found < capacity)
+                        outHandles[found] = handle;
+                    found++;
+                }
+            }
+        });
+        return found;
+    }
+
+    uint32_t SpatialHashGrid::QuerySphere(const glm::vec3& center, float radius, uint32_t* outHandles, uint32_t capacity) const {
+        uint32_t found = 0;
+        const float radiusSq = radius * radius;
+        ForEachCell(center - glm::vec3(radius), center + glm::vec3(radius), [&](const Cell& c) {
+            for (uint32_t handle : c.Objects) {
+                const Object& o = m_Objects[handle];
+                if (DistanceSqToAABB(center, o.Min, o.Max) <= radiusSq) {
+                    if (found < capacity)
+                        outHandles[found] = handle;
+                    found++;
+                }
+            }
+        });
+        return found;
+    }
+
+    uint32_t SpatialHashGrid::QueryFrustum(const Frustum& frustum, uint32_t* outHandles, uint32_t capacity) const {
+        // Bound the search by the frustum's eight corners
+        const glm::vec4* p = frustum.Planes;
+        glm::vec3 min(FLT_MAX), max(-FLT_MAX);
+        for (int corner = 0; corner < 8; corner++) {
+            glm::vec3 v = IntersectPlanes(p[corner & 1], p[2 + ((corner >> 1) & 1)], p[4 + (corner >> 2)]);
+            min = glm::min(min, v);
+            max = glm::max(max, v);
+        }
+
+        uint32_t found = 0;
+        ForEachCell(min, max, [&](const Cell& c) {
+            // Loose cell bounds: any object centred in the cell fits inside
+            glm::vec3 cellMin = glm::vec3((float)c.X, (float)c.Y, (float)c.Z) * m_CellSize - m_MaxHalfExtent;
+            glm::vec3 cellMax = cellMin + glm::vec3(m_CellSize) + m_MaxHalfExtent * 2.0f;
+            if (!frustum.IntersectsAABB(cellMin, cellMax))
+                return;
+            for (uint32_t handle : c.Objects) {
+                const Object& o = m_Objects[handle];
+                if (frustum.IntersectsAABB(o.Min, o.Max)) {
+                    if (found < capacity)
+                        outHandles[found] = handle;
+                    found++;
+                }
+            }
+        });
+        return found;
+    }
+
+    uint32_t SpatialHashGrid::QueryNearest(const glm::vec3& point, uint32_t k, uint32_t* outHandles, float* outDistances,
+                                           float maxDistance) const {
+        if (k == 0 || m_ObjectCount == 0)
+            return 0;
+
+        int32_t center[3];
+        CellCoords(point, center[0], center[1], center[2]);
+
+        // Shells of cells at growing Chebyshev distance; nothing below `first` is inside the bounds
+        int32_t first = 0, last = 0;
+        for (int axis = 0; axis < 3; axis++) {
+            first = std::max(first, std::max(m_BoundsMin[axis] - center[axis], center[axis] - m_BoundsMax[axis]));
+            last = std::max(last, std::max(center[axis] - m_BoundsMin[axis], m_BoundsMax[axis] - center[axis]));
+        }
+
+        const float maxDistanceSq = maxDistance < FLT_MAX ? maxDistance * maxDistance : FLT_MAX;
+        const float maxHalf = std::max(m_MaxHalfExtent.x, std::max(m_MaxHalfExtent.y, m_MaxHalfExtent.z));
+        uint32_t found = 0; // outDistances hold squared distances, sorted, until the end
+
+        auto visit = [&](int32_t x, int32_t y, int32_t z) {
+            uint32_t cell = FindCell(x, y, z);
+            if (cell == InvalidHandle)
+                return;
+            for (uint32_t handle : m_Cells[cell].Objects) {
+                const Object& o = m_Objects[handle];
+                float d = DistanceSqToAABB(point, o.Min, o.Max);
+                if (d > maxDistanceSq || (found == k && d >= outDistances[k - 1]))
+                    continue;
+                uint32_t i = found < k ? found++ : k - 1;
+                while (i > 0 && outDistances[i - 1] > d) {
+                    outDistances[i] = outDistances[i - 1];
+                    outHandles[i] = outHandles[i - 1];
+                    i--;
+                }
+                outDistances[i] = d;
+                outHandles[i] = handle;
+            }
+        };
+
+        for (int32_t r = first; r <= last; r++) {
+            // Objects in unvisited shells are centred at least r cells away
+            float bound = std::max(0.0f, (float)(r - 1) * m_CellSize - maxHalf);
+            if (bound * bound > maxDistanceSq || (found == k && bound * bound >= outDistances[k - 1]))
+                break;
+
+            int32_t x0 = std::max(center[0] - r, m_BoundsMin[0]), x1 = std::min(center[0] + r, m_BoundsMax[0]);
+            int32_t y0 = std::max(center[1] - r, m_BoundsMin[1]), y1 = std::min(center[1] + r, m_BoundsMax[1]);
+            int32_t z0 = std::max(center[2] - r, m_BoundsMin[2]), z1 = std::min(center[2] + r, m_BoundsMax[2]);
+            for (int32_t y = y0; y <= y1; y++) {
+                for (int32_t x = x0; x <= x1; x++) {
+                    if (std::abs(x - center[0]) == r || std::abs(y - center[1]) == r) {
+                        for (int32_t z = z0; z <= z1; z++)
+                            visit(x, y, z);
+                    } else {
+                        if (center[2] - r >= z0)
+                            visit(x, y, center[2] - r);
+                        if (r > 0 && center[2] + r <= z1)
+                            visit(x, y, center[2] + r);
+                    }
+                }
+            }
+        }
+
+        for (uint32_t i = 0; i < found; i++)
+            outDistances[i] = std::sqrt(outDistances[i]);
+        return found;
+    }
+
+}
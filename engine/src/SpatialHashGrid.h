@@ -0,0 +1,80 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <cfloat>
+#include <cstdint>
+#include <vector>
+
+namespace Groove {
+
+    struct Frustum;
+
+    // Dynamic uniform grid over an unbounded world, cells found through an open-addressed hash.
+    // Each object lives in exactly one cell (the one holding its AABB centre) and queries widen
+    // their search by the largest half extent seen, so moving within a cell only rewrites the
+    // bounds and crossing cells is two O(1) swaps. Queries never allocate: results go into
+    // caller-provided buffers.
+    class SpatialHashGrid {
+    public:
+        static const uint32_t InvalidHandle = 0xFFFFFFFFu;
+
+        // cellSize should be around the typical object size
+        explicit SpatialHashGrid(float cellSize = 2.0f);
+
+        uint32_t Insert(const glm::vec3& min, const glm::vec3& max);
+        void Move(uint32_t handle, const glm::vec3& min, const glm::vec3& max);
+        void Remove(uint32_t handle);
+        void Clear();
+        void Reserve(uint32_t objectCount);
+
+        // Write up to capacity handles and return the total number of matches (may exceed capacity)
+        uint32_t QueryAABB(const glm::vec3& min, const glm::vec3& max, uint32_t* outHandles, uint32_t capacity) const;
+        uint32_t QuerySphere(const glm::vec3& center, float radius, uint32_t* outHandles, uint32_t capacity) const;
+        uint32_t QueryFrustum(const Frustum& frustum, uint32_t* outHandles, uint32_t capacity) const;
+
+        // Up to k handles ordered by distance from point to their AABB (0 inside); outDistances
+        // receives the matching distances. Returns how many were found.
+        uint32_t QueryNearest(const glm::vec3& point, uint32_t k, uint32_t* outHandles, float* outDistances,
+                              float maxDistance = FLT_MAX) const;
+
+        uint32_t GetObjectCount() const { return m_ObjectCount; }
+        uint32_t GetCellCount() const { return (uint32_t)m_Cells.size(); }
+        float GetCellSize() const { return m_CellSize; }
+
+    private:
+        struct Object {
+            glm::vec3 Min, Max;
+            uint32_t Cell;  // InvalidHandle when the slot is free
+            uint32_t Slot;  // index in the cell's list, or next free object when free
+        };
+
+        struct Cell {
+            int32_t X, Y, Z;
+            std::vector<uint32_t> Objects;
+        };
+
+        void CellCoords(const glm::vec3& p, int32_t& x, int32_t& y, int32_t& z) const;
+        uint32_t FindCell(int32_t x, int32_t y, int32_t z) const;
+        uint32_t FindOrCreateCell(int32_t x, int32_t y, int32_t z);
+        void Rehash(uint32_t tableSize);
+        void AddToCell(uint32_t handle, uint32_t cell);
+        void RemoveFromCell(uint32_t handle);
+
+        // Calls fn(cell) for every non-empty cell whose centre region may hold objects overlapping [min, max]
+        template<typename Fn>
+        void ForEachCell(const glm::vec3& min, const glm::vec3& max, Fn fn) const;
+
+        float m_CellSize, m_InvCellSize;
+        glm::vec3 m_MaxHalfExtent{ 0.0f };
+
+        std::vector<Object> m_Objects;
+        uint32_t m_FreeList = InvalidHandle;
+        uint32_t m_ObjectCount = 0;
+
+        std::vector<Cell> m_Cells;
+        std::vector<uint32_t> m_Table; // power-of-two size, cell index or InvalidHandle
+        int32_t m_BoundsMin[3], m_BoundsMax[3]; // cell coordinates ever used
+    };
+
+}
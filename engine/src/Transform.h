@@ -20,6 +20,16 @@ namespace Groove {
             glm::mat4 S = glm::scale(glm::mat4(1.0f), Scale);  
             return T * R * S;  
         }  
+
+        // World AABB of the transformed unit cube
+        void GetBounds(glm::vec3& outMin, glm::vec3& outMax) const {
+            glm::mat4 m = GetMatrix();
+            for (int axis = 0; axis < 3; axis++) {
+                float extent = 0.5f * (glm::abs(m[0][axis]) + glm::abs(m[1][axis]) + glm::abs(m[2][axis]));
+                outMin[axis] = m[3][axis] - extent;
+                outMax[axis] = m[3][axis] + extent;
+            }
+        }
     };  
 
 }
@@ -4,18 +4,41 @@
 
 #include <GLFW/glfw3.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <timeapi.h>
+#endif
+
 namespace Groove {
 
-    Window::Window(int width, int height, const std::string& title)
+    // Below this much remaining time the limiter spins instead of sleeping
+    static const double SpinThreshold = 0.002;
+
+    static const char* GetPresentModeName(PresentMode mode) {
+        switch (mode) {
+            case PresentMode::VSync:      return "VSync";
+            case PresentMode::Uncapped:   return "Uncapped";
+            case PresentMode::Limited:    return "Frame limiter";
+            case PresentMode::LowLatency: return "Low latency";
+        }
+        return "Unknown";
+    }
+
+    Window::Window(int width, int height, const std::string& title, bool visible)
         : m_Width(width), m_Height(height), m_Title(title) {
-        Init(width, height, title);
+        Init(width, height, title, visible);
     }
 
     Window::~Window() {
         Shutdown();
     }
 
-    void Window::Init(int width, int height, const std::string& title) {
+    void Window::Init(int width, int height, const std::string& title, bool visible) {
         Logger::Info("Creating window: " + title);
 
         if (!glfwInit()) {
@@ -26,6 +49,7 @@ namespace Groove {
         glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
         glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
         glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        glfwWindowHint(GLFW_VISIBLE, visible ? GLFW_TRUE : GLFW_FALSE);
 
         m_Window = glfwCreateWindow(width, height, title.c_str(), nullptr, nullptr);
         if (!m_Window) {
@@ -36,15 +60,124 @@ namespace Groove {
 
         glfwMakeContextCurrent(m_Window);
         glfwSwapInterval(1); // Enable VSync
+
+        // Track the framebuffer size, so user resizes reach the viewport and input recordings
+        glfwSetWindowUserPointer(m_Window, this);
+        glfwSetFramebufferSizeCallback(m_Window, [](GLFWwindow* window, int width, int height) {
+            if (width <= 0 || height <= 0)
+                return; // minimized: keep the last usable size
+            Window* self = static_cast<Window*>(glfwGetWindowUserPointer(window));
+            self->m_Width = width;
+            self->m_Height = height;
+        });
+        glfwGetFramebufferSize(m_Window, &m_Width, &m_Height);
+
+        const GLFWvidmode* videoMode = glfwGetVideoMode(glfwGetPrimaryMonitor());
+        if (videoMode && videoMode->refreshRate > 0)
+            m_RefreshPeriod = 1.0 / videoMode->refreshRate;
+        m_Stats.RefreshMs = (float)(m_RefreshPeriod * 1000.0);
+
+#ifdef _WIN32
+        // 1 ms sleep granularity for the frame limiter
+        timeBeginPeriod(1);
+#endif
+        m_LastPresent = m_InputTime = glfwGetTime();
     }
 
-    void Window::OnUpdate() {
+    void Window::SetSize(int width, int height) {
+        m_Width = width;
+        m_Height = height;
+        // Sizes are framebuffer pixels; the window is sized in screen coordinates, which differ
+        // on scaled displays
+        int windowWidth, windowHeight, framebufferWidth, framebufferHeight;
+        glfwGetWindowSize(m_Window, &windowWidth, &windowHeight);
+        glfwGetFramebufferSize(m_Window, &framebufferWidth, &framebufferHeight);
+        if (framebufferWidth > 0 && framebufferHeight > 0)
+            glfwSetWindowSize(m_Window, width * windowWidth / framebufferWidth, height * windowHeight / framebufferHeight);
+        else
+            glfwSetWindowSize(m_Window, width, height);
+    }
+
+    void Window::SetPresentMode(PresentMode mode) {
+        m_PresentMode = mode;
+        glfwSwapInterval(mode == PresentMode::VSync || mode == PresentMode::LowLatency ? 1 : 0);
+        m_WorkEstimate = 0.0;
+        Logger::Info(std::string("Present mode: ") + GetPresentModeName(mode));
+    }
+
+    // Hybrid wait: coarse sleeps while far from the deadline, then spin for precision
+    void Window::WaitUntil(double time) {
+        for (;;) {
+            double remaining = time - glfwGetTime();
+            if (remaining <= 0.0)
+                return;
+            if (remaining > SpinThreshold)
+                std::this_thread::sleep_for(std::chrono::duration<double>(remaining - SpinThreshold));
+            else
+                std::this_thread::yield();
+        }
+    }
+
+    void Window::BeginFrame() {
+        double waitStart = glfwGetTime();
+
+        if (m_PresentMode == PresentMode::Limited) {
+            WaitUntil(m_InputTime + m_TargetFrameTime);
+        } else if (m_PresentMode == PresentMode::LowLatency) {
+            // Start late enough that the frame's work ends just before the next vblank
+            double deadline = m_LastPresent + m_RefreshPeriod;
+            WaitUntil(deadline - m_WorkEstimate - m_SafetyMargin);
+        }
+
+        // Poll after the wait so the frame simulates the freshest input
         glfwPollEvents();
+        m_InputTime = glfwGetTime();
+        m_Stats.WaitMs = (float)((m_InputTime - waitStart) * 1000.0);
+    }
+
+    void Window::OnUpdate() {
+        double swapStart = glfwGetTime();
+        double work = swapStart - m_InputTime;
+        // Jump up on spikes, decay slowly, so low-latency mode does not keep missing vblank
+        m_WorkEstimate = work > m_WorkEstimate ? work : m_WorkEstimate * 0.95 + work * 0.05;
+
         glfwSwapBuffers(m_Window);
+
+        double present = glfwGetTime();
+        m_Stats.WorkMs = (float)(work * 1000.0);
+        UpdateStats(present);
+        m_LastPresent = present;
+    }
+
+    void Window::UpdateStats(double presentTime) {
+        m_FrameSamples[m_FrameSampleIndex] = (float)((presentTime - m_LastPresent) * 1000.0);
+        m_FrameSampleIndex = (m_FrameSampleIndex + 1) % FrameSampleCount;
+        m_FrameSampleFill = std::min(m_FrameSampleFill + 1, FrameSampleCount);
+
+        float sum = 0.0f, minMs = m_FrameSamples[0], maxMs = m_FrameSamples[0];
+        for (uint32_t i = 0; i < m_FrameSampleFill; i++) {
+            sum += m_FrameSamples[i];
+            minMs = std::min(minMs, m_FrameSamples[i]);
+            maxMs = std::max(maxMs, m_FrameSamples[i]);
+        }
+        float mean = sum / m_FrameSampleFill;
+        float variance = 0.0f;
+        for (uint32_t i = 0; i < m_FrameSampleFill; i++)
+            variance += (m_FrameSamples[i] - mean) * (m_FrameSamples[i] - mean);
+
+        m_Stats.FrameMs = mean;
+        m_Stats.JitterMs = std::sqrt(variance / m_FrameSampleFill);
+        m_Stats.MinFrameMs = minMs;
+        m_Stats.MaxFrameMs = maxMs;
+        // Poll to swap return, plus on average half a refresh until scan-out reaches the pixel
+        m_Stats.InputLatencyMs = (float)((presentTime - m_InputTime + 0.5 * m_RefreshPeriod) * 1000.0);
     }
 
 
     void Window::Shutdown() {
+#ifdef _WIN32
+        timeEndPeriod(1);
+#endif
         glfwDestroyWindow(m_Window);
         glfwTerminate();
         Logger::Info("Window destroyed and GLFW terminated.");
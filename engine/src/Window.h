@@ -1,21 +1,56 @@
 ﻿// engine/src/Window.h
 #pragma once
 #include <string>
+#include <cstdint>
 #include <GLFW/glfw3.h> // Ensure GLFW is included
 
 struct GLFWwindow;
 
 namespace Groove {
 
+    enum class PresentMode {
+        VSync = 0,      // swap interval 1
+        Uncapped,       // swap interval 0, no waiting
+        Limited,        // swap interval 0, sleep-then-spin to the target frame time
+        LowLatency      // vsync, but input is polled as late as the measured frame work allows
+    };
+
+    struct FrameStats {
+        float FrameMs = 0.0f;          // mean over the sample window
+        float JitterMs = 0.0f;         // standard deviation of frame time
+        float MinFrameMs = 0.0f;
+        float MaxFrameMs = 0.0f;
+        float WorkMs = 0.0f;           // input poll to swap call
+        float WaitMs = 0.0f;           // pacing wait before the poll, last frame
+        float InputLatencyMs = 0.0f;   // estimated input poll to scan-out
+        float RefreshMs = 0.0f;        // monitor refresh period
+    };
+
     class Window {
     public:
-        Window(int width, int height, const std::string& title);
+        // A hidden window still has a GL context, for headless replays
+        Window(int width, int height, const std::string& title, bool visible = true);
         ~Window();
 
+        // Start of frame: waits as the present mode requires, then polls input
+        void BeginFrame();
+        // End of frame: presents and updates the frame statistics
         void OnUpdate();
 
+        void SetPresentMode(PresentMode mode);
+        PresentMode GetPresentMode() const { return m_PresentMode; }
+        // Frame limiter target, in seconds
+        void SetTargetFrameTime(double seconds) { m_TargetFrameTime = seconds; }
+        double GetTargetFrameTime() const { return m_TargetFrameTime; }
+        // Extra slack kept before the vsync deadline in LowLatency mode
+        void SetLatencySafetyMargin(double seconds) { m_SafetyMargin = seconds; }
+
+        const FrameStats& GetFrameStats() const { return m_Stats; }
+
+        // Framebuffer size in pixels, kept current by a GLFW callback
         int GetWidth()  const { return m_Width; }
         int GetHeight() const { return m_Height; }
+        void SetSize(int width, int height);
 
         void* GetNativeWindow() const { return m_Window; }
 
@@ -25,12 +60,29 @@ namespace Groove {
         }
 
     private:
-        void Init(int width, int height, const std::string& title);
+        void Init(int width, int height, const std::string& title, bool visible);
         void Shutdown();
+        void WaitUntil(double time);
+        void UpdateStats(double presentTime);
 
         GLFWwindow* m_Window;
         std::string m_Title;
         int m_Width, m_Height;
+
+        PresentMode m_PresentMode = PresentMode::VSync;
+        double m_TargetFrameTime = 1.0 / 120.0;
+        double m_SafetyMargin = 0.002;
+        double m_RefreshPeriod = 1.0 / 60.0;
+
+        double m_InputTime = 0.0;       // when input was polled
+        double m_LastPresent = 0.0;     // when the previous swap returned
+        double m_WorkEstimate = 0.0;    // smoothed poll-to-swap time
+
+        static const uint32_t FrameSampleCount = 120;
+        float m_FrameSamples[FrameSampleCount] = {};
+        uint32_t m_FrameSampleIndex = 0;
+        uint32_t m_FrameSampleFill = 0;
+        FrameStats m_Stats;
     };
 
 } // namespace Groove
@@ -1,8 +1,32 @@
 #include "Engine.h"
 
-int main() {
-    Engine::Init();
+#include <cstdlib>
+#include <cstring>
+
+// Sandbox [--record file.grin] [--replay file.grin] [--timing frames.csv] [--metrics-prom file.prom] [--headless]
+//         [--alloc-check frames]
+// --alloc-check runs that many steady frames and exits with 1 if any of them called operator new
+int main(int argc, char** argv) {
+    Engine::Config config;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc)
+            config.RecordInputPath = argv[++i];
+        else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc)
+            config.ReplayInputPath = argv[++i];
+        else if (std::strcmp(argv[i], "--timing") == 0 && i + 1 < argc)
+            config.TimingCsvPath = argv[++i];
+        else if (std::strcmp(argv[i], "--metrics-prom") == 0 && i + 1 < argc)
+            config.MetricsPrometheusPath = argv[++i];
+        else if (std::strcmp(argv[i], "--headless") == 0)
+            config.Headless = true;
+        else if (std::strcmp(argv[i], "--alloc-check") == 0 && i + 1 < argc)
+            config.AllocationCheckFrames = (unsigned int)std::strtoul(argv[++i], nullptr, 10);
+    }
+
+    Engine::Init(config);
     Engine::Run();
     Engine::Shutdown();
+    if (config.AllocationCheckFrames && !Engine::PassedAllocationCheck())
+        return 1;
     return 0;
 }
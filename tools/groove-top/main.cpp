@@ -0,0 +1,219 @@
+#include "MetricsLayout.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// groove-top [--interval ms] [--once]
+// Live view of a running engine's metrics. The segment is mapped read-only and read with the
+// seqlock retry loop, so the engine never waits on this process.
+
+using namespace Groove;
+
+struct Snapshot {
+    uint64_t PublishCount = 0;
+    double   TimeSeconds = 0.0;
+    int64_t  ProcessId = 0;
+    std::vector<MetricsEntry> Entries;
+};
+
+class SegmentReader {
+public:
+    ~SegmentReader() { Close(); }
+
+    bool Open() {
+        Close();
+#ifdef _WIN32
+        m_Mapping = OpenFileMappingA(FILE_MAP_READ, FALSE, MetricsSegmentName);
+        if (!m_Mapping)
+            return false;
+        m_Segment = static_cast<const MetricsSegment*>(MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, sizeof(MetricsSegment)));
+#else
+        int fd = shm_open(MetricsSegmentName, O_RDONLY, 0);
+        if (fd < 0)
+            return false;
+        void* view = mmap(nullptr, sizeof(MetricsSegment), PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        m_Segment = view == MAP_FAILED ? nullptr : static_cast<const MetricsSegment*>(view);
+#endif
+        return m_Segment != nullptr;
+    }
+
+    void Close() {
+        if (m_Segment) {
+#ifdef _WIN32
+            UnmapViewOfFile(m_Segment);
+#else
+            munmap(const_cast<MetricsSegment*>(m_Segment), sizeof(MetricsSegment));
+#endif
+        }
+#ifdef _WIN32
+        if (m_Mapping)
+            CloseHandle(m_Mapping);
+        m_Mapping = nullptr;
+#endif
+        m_Segment = nullptr;
+    }
+
+    bool IsOpen() const { return m_Segment != nullptr; }
+
+    // Copies a consistent snapshot; false if the engine has not initialised the segment yet
+    bool Read(Snapshot& out) const {
+        if (m_Segment->Magic != MetricsMagic || m_Segment->Version != MetricsVersion)
+            return false;
+        for (int attempt = 0; attempt < 10000; attempt++) {
+            uint32_t before = m_Segment->Sequence.load(std::memory_order_acquire);
+            if (before & 1) {
+                std::this_thread::yield();
+                continue;
+            }
+            uint32_t count = m_Segment->EntryCount;
+            if (count > MetricsMaxEntries)
+                continue;
+            out.PublishCount = m_Segment->PublishCount;
+            out.TimeSeconds = m_Segment->TimeSeconds;
+            out.ProcessId = m_Segment->ProcessId;
+            out.Entries.resize(count);
+            std::memcpy(out.Entries.data(), m_Segment->Entries, count * sizeof(MetricsEntry));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_Segment->Sequence.load(std::memory_order_relaxed) == before)
+                return true;
+        }
+        return false;
+    }
+
+private:
+    const MetricsSegment* m_Segment = nullptr;
+#ifdef _WIN32
+    HANDLE m_Mapping = nullptr;
+#endif
+};
+
+// Linear interpolation inside the bucket holding the q-th observation
+static double Quantile(const MetricsEntry& e, double q, bool& overflow) {
+    overflow = false;
+    if (e.Count == 0)
+        return 0.0;
+    double rank = q * (double)e.Count;
+    double lower = 0.0;
+    uint64_t below = 0;
+    for (uint32_t b = 0; b < e.BoundCount; b++) {
+        if ((double)e.Buckets[b] >= rank) {
+            uint64_t inBucket = e.Buckets[b] - below;
+            double t = inBucket ? (rank - (double)below) / (double)inBucket : 1.0;
+            return lower + (e.Bounds[b] - lower) * t;
+        }
+        lower = e.Bounds[b];
+        below = e.Buckets[b];
+    }
+    overflow = true;
+    return lower;
+}
+
+static const char* TypeName(uint32_t type) {
+    switch ((MetricType)type) {
+        case MetricType::Counter:   return "counter";
+        case MetricType::Gauge:     return "gauge";
+        case MetricType::Histogram: return "histogram";
+        default:                    return "?";
+    }
+}
+
+static void Print(const Snapshot& now, const Snapshot& previous) {
+    std::printf("Groove metrics | pid %lld | publish #%llu | engine time %.1f s\n\n",
+                (long long)now.ProcessId, (unsigned long long)now.PublishCount, now.TimeSeconds);
+    std::printf("%-48s %-10s %14s  %s\n", "NAME", "TYPE", "VALUE", "DETAIL");
+
+    double elapsed = now.TimeSeconds - previous.TimeSeconds;
+    for (size_t i = 0; i < now.Entries.size(); i++) {
+        const MetricsEntry& e = now.Entries[i];
+        const MetricsEntry* before = i < previous.Entries.size() &&
+            std::strcmp(previous.Entries[i].Name, e.Name) == 0 ? &previous.Entries[i] : nullptr;
+
+        if (e.Type == (uint32_t)MetricType::Histogram) {
+            bool over50, over95, over99;
+            double p50 = Quantile(e, 0.50, over50), p95 = Quantile(e, 0.95, over95), p99 = Quantile(e, 0.99, over99);
+            std::printf("%-48s %-10s %14llu  mean %.3g | p50 %s%.3g | p95 %s%.3g | p99 %s%.3g\n", e.Name, TypeName(e.Type),
+                        (unsigned long long)e.Count, e.Count ? e.Sum / (double)e.Count : 0.0,
+                        over50 ? ">" : "", p50, over95 ? ">" : "", p95, over99 ? ">" : "", p99);
+        }
+        else if (e.Type == (uint32_t)MetricType::Counter && before && elapsed > 0.0) {
+            std::printf("%-48s %-10s %14.0f  %.1f/s\n", e.Name, TypeName(e.Type), e.Value,
+                        (e.Value - before->Value) / elapsed);
+        }
+        else {
+            std::printf("%-48s %-10s %14.6g\n", e.Name, TypeName(e.Type), e.Value);
+        }
+    }
+    std::fflush(stdout);
+}
+
+int main(int argc, char** argv) {
+    int intervalMs = 1000;
+    bool once = false;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--interval") == 0 && i + 1 < argc)
+            intervalMs = std::max(50, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "--once") == 0)
+            once = true;
+        else {
+            std::printf("usage: groove-top [--interval ms] [--once]\n");
+            return 1;
+        }
+    }
+
+#ifdef _WIN32
+    // Let the clear-screen escape work in the classic console
+    HANDLE console = GetStdHandle(STD_OUTPUT_HANDLE);
+    DWORD mode = 0;
+    if (GetConsoleMode(console, &mode))
+        SetConsoleMode(console, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
+#endif
+
+    SegmentReader reader;
+    Snapshot now, previous;
+    int staleIntervals = 0;
+    for (;;) {
+        if (!reader.IsOpen() && !reader.Open()) {
+            if (once) {
+                std::fprintf(stderr, "groove-top: no metrics segment %s (is the engine running?)\n", MetricsSegmentName);
+                return 1;
+            }
+            std::printf("\x1b[H\x1b[2JWaiting for the engine (%s)...\n", MetricsSegmentName);
+            std::fflush(stdout);
+        }
+        else if (reader.Read(now)) {
+            if (!once)
+                std::printf("\x1b[H\x1b[2J");
+            Print(now, previous);
+            if (once)
+                return 0;
+
+            // An exited engine leaves nothing behind on Windows, but a POSIX mapping outlives
+            // shm_unlink; reopen by name when publishing stops so a restarted engine is found
+            staleIntervals = now.PublishCount == previous.PublishCount ? staleIntervals + 1 : 0;
+            if (staleIntervals >= 3) {
+                reader.Close();
+                staleIntervals = 0;
+            }
+            std::swap(now, previous);
+        }
+        else if (once) {
+            std::fprintf(stderr, "groove-top: metrics segment is not initialised yet\n");
+            return 1;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(intervalMs));
+    }
+}